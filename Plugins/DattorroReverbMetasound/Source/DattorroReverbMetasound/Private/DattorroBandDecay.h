@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace Audio
+{
+	/// Summary
+	///
+	/// Three band decay gain for the two sides of a reverb tank, in one SIMD register.
+	/// Each side is split by two one pole low passes (low crossover and high crossover): low = LP(low),
+	/// mid = LP(high) - LP(low), high = x - LP(high). The bands sum back to x exactly, so equal gains are a plain multiply
+	/// with no phase shift. The four filter states sit in one register as [Left Low, Right Low, Left High, Right High],
+	/// so a frame is one multiply-add for the filters and two for the gains, whatever the band settings.
+	///
+	/// Summary
+	class FStereoBandDecay
+	{
+	public:
+		// Sets the two crossover frequencies. Only call when they change - this is the one place exp is evaluated.
+		void SetCrossovers(const float InLowFrequency, const float InHighFrequency, const float InSampleRate)
+		{
+			const float LowCoefficient = 1.0f - FMath::Exp(-UE_TWO_PI * InLowFrequency / InSampleRate);
+			const float HighCoefficient = 1.0f - FMath::Exp(-UE_TWO_PI * InHighFrequency / InSampleRate);
+			Coefficients = MakeVectorRegisterFloat(LowCoefficient, LowCoefficient, HighCoefficient, HighCoefficient);
+		}
+
+		// Sets each side's linear gain per band (applied once per pass through that side).
+		void SetGains(const float InLeftGains[3], const float InRightGains[3])
+		{
+			// y = High * x + (Low - Mid) * LP(low) + (Mid - High) * LP(high)
+			StateGains = MakeVectorRegisterFloat(InLeftGains[0] - InLeftGains[1], InRightGains[0] - InRightGains[1], InLeftGains[1] - InLeftGains[2], InRightGains[1] - InRightGains[2]);
+			HighGains = MakeVectorRegisterFloat(InLeftGains[2], InRightGains[2], 0.0f, 0.0f);
+		}
+
+		// Applies the band gains to one frame of both sides, in place.
+		FORCEINLINE void ProcessFrame(float& InOutLeft, float& InOutRight)
+		{
+			const VectorRegister4Float Input = MakeVectorRegisterFloat(InOutLeft, InOutRight, InOutLeft, InOutRight);
+			States = VectorMultiplyAdd(Coefficients, VectorSubtract(Input, States), States);
+
+			// Fold the high crossover lanes onto the low ones, then add the high band's direct path
+			const VectorRegister4Float Weighted = VectorMultiply(StateGains, States);
+			const VectorRegister4Float Summed = VectorAdd(Weighted, VectorSwizzle(Weighted, 2, 3, 0, 1));
+			const VectorRegister4Float Output = VectorMultiplyAdd(HighGains, Input, Summed);
+
+			InOutLeft = VectorGetComponent(Output, 0);
+			InOutRight = VectorGetComponent(Output, 1);
+		}
+
+		void Reset()
+		{
+			States = VectorZeroFloat();
+		}
+
+	private:
+		VectorRegister4Float Coefficients = VectorZeroFloat();
+		VectorRegister4Float States = VectorZeroFloat();
+		VectorRegister4Float StateGains = VectorZeroFloat();
+		VectorRegister4Float HighGains = MakeVectorRegisterFloat(1.0f, 1.0f, 0.0f, 0.0f);
+	};
+}
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace Audio
+{
+	/// Summary
+	///
+	/// Crossfade gain for the doppler pitch shifters: sin(pi * Phase) for a phase in [0, 1),
+	/// the same curve as cos(pi * (Phase - 0.5)) but without any trig.
+	/// With t = 2 * Phase - 1 the curve is cos(pi / 2 * t), an even function, so it is evaluated as a polynomial in t^2
+	/// (Taylor terms up to t^8, worst error ~3e-5 at the ends, where the gain is already near zero).
+	///
+	/// Summary
+	namespace CrossfadeGain
+	{
+		static constexpr float C0 = 1.0f;
+		static constexpr float C2 = -1.23370055f;
+		static constexpr float C4 = 0.25366951f;
+		static constexpr float C6 = -0.02086348f;
+		static constexpr float C8 = 0.00091926f;
+	}
+
+	FORCEINLINE float GetCrossfadeGain(const float InPhase)
+	{
+		using namespace CrossfadeGain;
+
+		const float T = 2.0f * InPhase - 1.0f;
+		const float T2 = T * T;
+		return C0 + T2 * (C2 + T2 * (C4 + T2 * (C6 + T2 * C8)));
+	}
+
+	FORCEINLINE VectorRegister4Float VectorCrossfadeGain(const VectorRegister4Float& InPhase)
+	{
+		using namespace CrossfadeGain;
+
+		const VectorRegister4Float T = VectorSubtract(VectorAdd(InPhase, InPhase), VectorOneFloat());
+		const VectorRegister4Float T2 = VectorMultiply(T, T);
+
+		VectorRegister4Float Result = VectorMultiplyAdd(T2, VectorSetFloat1(C8), VectorSetFloat1(C6));
+		Result = VectorMultiplyAdd(T2, Result, VectorSetFloat1(C4));
+		Result = VectorMultiplyAdd(T2, Result, VectorSetFloat1(C2));
+		return VectorMultiplyAdd(T2, Result, VectorSetFloat1(C0));
+	}
+}
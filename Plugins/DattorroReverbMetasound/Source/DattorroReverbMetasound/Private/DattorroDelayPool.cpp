@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroDelayPool.h"
+#include "HAL/UnrealMemory.h"
+#include "Misc/ScopeLock.h"
+
+namespace Audio
+{
+	FDelayBlockPool& FDelayBlockPool::Get()
+	{
+		static FDelayBlockPool Pool;
+		return Pool;
+	}
+
+	FDelayBlockPool::~FDelayBlockPool()
+	{
+		Trim();
+	}
+
+	int32 FDelayBlockPool::GetSizeClass(int32 InNumBytes)
+	{
+		// Round up to the next power of two, then offset so the smallest class is index 0.
+		const int32 Log2 = FMath::Max((int32)FMath::CeilLogTwo((uint32)FMath::Max(InNumBytes, 1)), MinSizeClassLog2);
+		return Log2 - MinSizeClassLog2;
+	}
+
+	FDelayBlock FDelayBlockPool::Acquire(int32 InNumBytes)
+	{
+		FDelayBlock Block;
+
+		const int32 SizeClass = GetSizeClass(InNumBytes);
+		if (!ensureMsgf(SizeClass < NumSizeClasses, TEXT("Delay block request of %d bytes is larger than the biggest pool size class"), InNumBytes))
+		{
+			return Block;
+		}
+
+		Block.SizeClass = SizeClass;
+		Block.NumBytes = 1 << (SizeClass + MinSizeClassLog2);
+
+		{
+			FScopeLock Lock(&FreeListCritSec);
+			if (FreeLists[SizeClass].Num() > 0)
+			{
+				Block.Data = FreeLists[SizeClass].Pop(EAllowShrinking::No);
+			}
+		}
+
+		// Nothing idle in this size class, so grow the pool.
+		if (Block.Data == nullptr)
+		{
+			Block.Data = FMemory::Malloc(Block.NumBytes, BlockAlignment);
+			BytesResident += Block.NumBytes;
+		}
+
+		// The next onset must never hear the previous owner's tail.
+		FMemory::Memzero(Block.Data, Block.NumBytes);
+		BytesInUse += Block.NumBytes;
+
+		return Block;
+	}
+
+	void FDelayBlockPool::Release(FDelayBlock& InOutBlock)
+	{
+		if (!InOutBlock.IsValid())
+		{
+			return;
+		}
+
+		{
+			FScopeLock Lock(&FreeListCritSec);
+			FreeLists[InOutBlock.SizeClass].Push(InOutBlock.Data);
+		}
+
+		BytesInUse -= InOutBlock.NumBytes;
+		InOutBlock = FDelayBlock();
+	}
+
+	void FDelayBlockPool::Trim()
+	{
+		FScopeLock Lock(&FreeListCritSec);
+		for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+		{
+			const int64 BlockBytes = 1LL << (SizeClass + MinSizeClassLog2);
+			for (void* Data : FreeLists[SizeClass])
+			{
+				FMemory::Free(Data);
+				BytesResident -= BlockBytes;
+			}
+			FreeLists[SizeClass].Empty();
+		}
+	}
+}
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+namespace Audio
+{
+	// A block of delay memory handed out by the pool. Data is null when the block is not held.
+	struct FDelayBlock
+	{
+		void* Data = nullptr;
+		// Usable size of the block in bytes (always the full size class, never the requested size).
+		int32 NumBytes = 0;
+		// Index of the power-of-two size class this block came from.
+		int32 SizeClass = INDEX_NONE;
+
+		bool IsValid() const { return Data != nullptr; }
+	};
+
+	/// Summary
+	///
+	/// Plugin-wide pool of delay memory, bucketed into power-of-two size classes.
+	/// Operators take a block when they become audible and hand it back once their tail has died away,
+	/// so the resident delay memory follows the number of active voices rather than the number of instantiated ones.
+	/// Blocks returned to the pool stay resident and are reused by the next acquire of the same size class.
+	/// Acquire and Release may be called from any audio render thread.
+	///
+	/// Summary
+	class FDelayBlockPool
+	{
+	public:
+		// Smallest and largest size classes, in bytes (256 B to 16 MB).
+		static constexpr int32 MinSizeClassLog2 = 8;
+		static constexpr int32 MaxSizeClassLog2 = 24;
+		static constexpr int32 NumSizeClasses = MaxSizeClassLog2 - MinSizeClassLog2 + 1;
+
+		// Alignment of every block, enough for 128-bit vector loads.
+		static constexpr int32 BlockAlignment = 16;
+
+		static FDelayBlockPool& Get();
+
+		~FDelayBlockPool();
+
+		// Returns a zeroed block of at least InNumBytes. Returns an invalid block if the request is larger than the biggest size class.
+		FDelayBlock Acquire(int32 InNumBytes);
+
+		// Returns the block to its size class free list and clears the handle.
+		void Release(FDelayBlock& InOutBlock);
+
+		// Frees every idle block. Blocks still held by operators are untouched.
+		void Trim();
+
+		// Bytes currently held by operators.
+		int64 GetBytesInUse() const { return BytesInUse; }
+
+		// Bytes allocated by the pool, whether held or idle.
+		int64 GetBytesResident() const { return BytesResident; }
+
+	private:
+		FDelayBlockPool() = default;
+
+		static int32 GetSizeClass(int32 InNumBytes);
+
+		FCriticalSection FreeListCritSec;
+		TArray<void*> FreeLists[NumSizeClasses];
+
+		std::atomic<int64> BytesInUse{ 0 };
+		std::atomic<int64> BytesResident{ 0 };
+	};
+}
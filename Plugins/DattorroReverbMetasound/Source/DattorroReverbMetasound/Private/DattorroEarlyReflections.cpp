@@ -0,0 +1,170 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroEarlyReflections.h"
+#include "Algo/Sort.h"
+#include "Math/VectorRegister.h"
+
+namespace Audio
+{
+	namespace EarlyReflections
+	{
+		static constexpr float SpeedOfSound = 343.0f;
+
+		// Highest image order searched - 62 image sources, enough for the nearest 32 in any of the presets
+		static constexpr int32 MaxOrder = 3;
+
+		// Low pass cutoff of a first order reflection in Hz. Each further bounce divides it again.
+		static constexpr float FirstOrderCutoff = 12000.0f;
+
+		// Source and listener positions, as fractions of the room's dimensions
+		static constexpr float SourcePosition[3] = { 0.3f, 0.4f, 0.5f };
+		static constexpr float ListenerPosition[3] = { 0.7f, 0.6f, 0.5f };
+
+		struct FImageSource
+		{
+			float Distance;
+			int32 Order;
+		};
+
+		// Image of a point at InPosition along one axis of length InLength, reflected InIndex times
+		static float GetImageCoordinate(const int32 InIndex, const float InPosition, const float InLength)
+		{
+			return (InIndex % 2 == 0) ? InIndex * InLength + InPosition : (InIndex + 1) * InLength - InPosition;
+		}
+	}
+
+	void FEarlyReflections::Init(const float InSampleRate, const int32 InMaxFrames, const int32 InNumTaps)
+	{
+		SampleRate = InSampleRate;
+		NumTapLanes = Align(FMath::Clamp(InNumTaps, 1, MaxTaps), 4);
+
+		for (TArray<float>* Table : { &TapDelays, &TapGains, &TapCoefficients, &TapStates })
+		{
+			Table->SetNumZeroed(NumTapLanes);
+		}
+		BlockDelays.SetNumZeroed(NumTapLanes * InMaxFrames);
+		BlockSamples.SetNumZeroed(NumTapLanes * InMaxFrames);
+	}
+
+	void FEarlyReflections::SetRoom(const FEarlyReflectionRoom& InRoom, const float InRoomSize, const float InLevel)
+	{
+		using namespace EarlyReflections;
+
+		float Lengths[3];
+		float Source[3];
+		float Listener[3];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Lengths[Axis] = InRoom.Dimensions[Axis] * InRoomSize;
+			Source[Axis] = SourcePosition[Axis] * Lengths[Axis];
+			Listener[Axis] = ListenerPosition[Axis] * Lengths[Axis];
+		}
+
+		// Every image source up to MaxOrder, nearest first
+		FImageSource Images[64];
+		int32 NumImages = 0;
+		for (int32 X = -MaxOrder; X <= MaxOrder; ++X)
+		{
+			for (int32 Y = -MaxOrder; Y <= MaxOrder; ++Y)
+			{
+				for (int32 Z = -MaxOrder; Z <= MaxOrder; ++Z)
+				{
+					const int32 Order = FMath::Abs(X) + FMath::Abs(Y) + FMath::Abs(Z);
+					if (Order == 0 || Order > MaxOrder)
+					{
+						continue;
+					}
+
+					const float DX = GetImageCoordinate(X, Source[0], Lengths[0]) - Listener[0];
+					const float DY = GetImageCoordinate(Y, Source[1], Lengths[1]) - Listener[1];
+					const float DZ = GetImageCoordinate(Z, Source[2], Lengths[2]) - Listener[2];
+					Images[NumImages++] = { FMath::Sqrt(DX * DX + DY * DY + DZ * DZ), Order };
+				}
+			}
+		}
+		Algo::Sort(MakeArrayView(Images, NumImages), [](const FImageSource& A, const FImageSource& B) { return A.Distance < B.Distance; });
+
+		// Delays and spreading loss are relative to the direct sound, which the dry path already carries
+		const float DX = Source[0] - Listener[0];
+		const float DY = Source[1] - Listener[1];
+		const float DZ = Source[2] - Listener[2];
+		const float DirectDistance = FMath::Max(FMath::Sqrt(DX * DX + DY * DY + DZ * DZ), 1.0f);
+
+		const int32 NumTaps = FMath::Min(InRoom.NumTaps, NumTapLanes);
+		for (int32 Tap = 0; Tap < NumTapLanes; ++Tap)
+		{
+			if (Tap >= NumTaps)
+			{
+				TapDelays[Tap] = 0.0f;
+				TapGains[Tap] = 0.0f;
+				TapCoefficients[Tap] = 0.0f;
+				continue;
+			}
+
+			const FImageSource& Image = Images[Tap];
+			const float DelayTime = FMath::Min((Image.Distance - DirectDistance) / SpeedOfSound, MaxDelayTime);
+			const float Cutoff = FMath::Min(FirstOrderCutoff / Image.Order, 0.45f * SampleRate);
+
+			TapDelays[Tap] = FMath::Max(DelayTime, 0.0f) * SampleRate;
+			TapGains[Tap] = InLevel * FMath::Pow(InRoom.Reflection, (float)Image.Order) * DirectDistance / Image.Distance;
+			TapCoefficients[Tap] = 1.0f - FMath::Exp(-UE_TWO_PI * Cutoff / SampleRate);
+		}
+	}
+
+	void FEarlyReflections::Reset()
+	{
+		FMemory::Memzero(TapStates.GetData(), TapStates.Num() * sizeof(float));
+	}
+
+	void FEarlyReflections::ProcessBlock(const FPooledDelay& InDelay, const int32 InNumFrames, float* OutLeft, float* OutRight)
+	{
+		const int32 NumGroups = NumTapLanes / 4;
+		const int32 NumEntries = InNumFrames * NumTapLanes;
+		check(NumEntries <= BlockDelays.Num());
+
+		// Frame i's own input sits InNumFrames - i samples back, so each of its taps is that much further
+		for (int32 FrameIndex = 0; FrameIndex < InNumFrames; ++FrameIndex)
+		{
+			const VectorRegister4Float FramesAhead = VectorSetFloat1((float)(InNumFrames - FrameIndex));
+			float* FrameDelays = &BlockDelays[FrameIndex * NumTapLanes];
+			for (int32 Lane = 0; Lane < NumTapLanes; Lane += 4)
+			{
+				VectorStore(VectorAdd(VectorLoad(&TapDelays[Lane]), FramesAhead), FrameDelays + Lane);
+			}
+		}
+
+		// Every tap of the block in one read of the delay
+		InDelay.ReadDelaySamplesBlock(TArrayView<const float>(BlockDelays.GetData(), NumEntries), TArrayView<float>(BlockSamples.GetData(), NumEntries));
+
+		VectorRegister4Float States[MaxTaps / 4];
+		VectorRegister4Float Coefficients[MaxTaps / 4];
+		VectorRegister4Float Gains[MaxTaps / 4];
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			States[Group] = VectorLoad(&TapStates[Group * 4]);
+			Coefficients[Group] = VectorLoad(&TapCoefficients[Group * 4]);
+			Gains[Group] = VectorLoad(&TapGains[Group * 4]);
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < InNumFrames; ++FrameIndex)
+		{
+			const float* FrameSamples = &BlockSamples[FrameIndex * NumTapLanes];
+			VectorRegister4Float Sum = VectorZeroFloat();
+			for (int32 Group = 0; Group < NumGroups; ++Group)
+			{
+				States[Group] = VectorMultiplyAdd(Coefficients[Group], VectorSubtract(VectorLoad(FrameSamples + Group * 4), States[Group]), States[Group]);
+				Sum = VectorMultiplyAdd(Gains[Group], States[Group], Sum);
+			}
+
+			// Lanes 0 and 2 hold the even taps (left), lanes 1 and 3 the odd taps (right)
+			const VectorRegister4Float Sides = VectorAdd(Sum, VectorSwizzle(Sum, 2, 3, 0, 1));
+			OutLeft[FrameIndex] = VectorGetComponent(Sides, 0);
+			OutRight[FrameIndex] = VectorGetComponent(Sides, 1);
+		}
+
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			VectorStore(States[Group], &TapStates[Group * 4]);
+		}
+	}
+}
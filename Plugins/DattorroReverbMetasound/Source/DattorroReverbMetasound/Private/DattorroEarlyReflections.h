@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DattorroPooledDelay.h"
+
+namespace Audio
+{
+	// A shoebox room the early reflection taps are worked out from.
+	struct FEarlyReflectionRoom
+	{
+		// Width, depth and height in metres, at a room size of 1
+		float Dimensions[3];
+
+		// Pressure reflection coefficient of the walls (0 to 1)
+		float Reflection;
+
+		// Number of taps, the nearest image sources first (8 to 32)
+		int32 NumTaps;
+	};
+
+	/// Summary
+	///
+	/// Early reflection stage - a tap delay read from an existing delay line (the reverb's pre-delay).
+	/// The taps are the nearest image sources of a shoebox room (Allen and Berkley, 1979) up to third order, each with its delay,
+	/// a gain for spreading and wall loss and a one pole low pass that darkens every further bounce. The table is only
+	/// rebuilt when the room or its size changes.
+	///
+	/// Per block, the taps of every frame are laid out interleaved ([frame][tap]) and resolved by one block read of the delay,
+	/// then four taps at a time are filtered and summed in SIMD registers. Even taps go left and odd taps right.
+	/// All scratch is sized in Init; ProcessBlock never allocates.
+	///
+	/// Summary
+	class FEarlyReflections
+	{
+	public:
+		static constexpr int32 MaxTaps = 32;
+
+		// Longest tap delay in seconds - the delay line read from must hold at least this much plus a block
+		static constexpr float MaxDelayTime = 0.25f;
+
+		// Sizes the scratch for blocks of up to InMaxFrames frames and InNumTaps taps.
+		void Init(const float InSampleRate, const int32 InMaxFrames, const int32 InNumTaps);
+
+		// Rebuilds the tap table for InRoom scaled by InRoomSize, at InLevel overall gain.
+		void SetRoom(const FEarlyReflectionRoom& InRoom, const float InRoomSize, const float InLevel);
+
+		// Clears the tap filters.
+		void Reset();
+
+		// Reads the taps for InNumFrames frames from InDelay, whose last InNumFrames samples are this block's input,
+		// and writes each side's reflections to OutLeft and OutRight.
+		void ProcessBlock(const FPooledDelay& InDelay, const int32 InNumFrames, float* OutLeft, float* OutRight);
+
+	private:
+		float SampleRate = 0.0f;
+
+		// Taps rounded up to a multiple of four - the padding taps have no gain
+		int32 NumTapLanes = 0;
+
+		// Tap table, one entry per lane
+		TArray<float> TapDelays;
+		TArray<float> TapGains;
+		TArray<float> TapCoefficients;
+		TArray<float> TapStates;
+
+		// Interleaved [frame][tap] read delays and samples for one block
+		TArray<float> BlockDelays;
+		TArray<float> BlockSamples;
+	};
+}
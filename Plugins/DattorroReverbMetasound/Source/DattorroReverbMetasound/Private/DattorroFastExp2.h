@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace Audio
+{
+	/// Summary
+	///
+	/// 2^x for the semitone to pitch ratio conversions of the pitch shifters, without a pow.
+	/// Valid for |x| <= 8 (+/- 96 semitones): 2^x is evaluated as (e^(x ln2 / 8))^8, where the exponent is small enough
+	/// for a degree 7 Taylor polynomial, followed by three squarings.
+	/// Worst relative error over +/- 6 octaves is ~3e-6 (0.005 cents), and it is plain float math, so it vectorises as is.
+	///
+	/// Summary
+	namespace FastExp2
+	{
+		static constexpr float ExponentScale = 0.0866433976f; // ln(2) / 8
+		static constexpr float C0 = 1.0f;
+		static constexpr float C1 = 1.0f;
+		static constexpr float C2 = 1.0f / 2.0f;
+		static constexpr float C3 = 1.0f / 6.0f;
+		static constexpr float C4 = 1.0f / 24.0f;
+		static constexpr float C5 = 1.0f / 120.0f;
+		static constexpr float C6 = 1.0f / 720.0f;
+		static constexpr float C7 = 1.0f / 5040.0f;
+	}
+
+	FORCEINLINE float GetFastExp2(const float InX)
+	{
+		using namespace FastExp2;
+
+		const float Z = InX * ExponentScale;
+		float Result = C0 + Z * (C1 + Z * (C2 + Z * (C3 + Z * (C4 + Z * (C5 + Z * (C6 + Z * C7))))));
+		Result *= Result;
+		Result *= Result;
+		return Result * Result;
+	}
+
+	FORCEINLINE VectorRegister4Float VectorFastExp2(const VectorRegister4Float& InX)
+	{
+		using namespace FastExp2;
+
+		const VectorRegister4Float Z = VectorMultiply(InX, VectorSetFloat1(ExponentScale));
+
+		VectorRegister4Float Result = VectorMultiplyAdd(Z, VectorSetFloat1(C7), VectorSetFloat1(C6));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C5));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C4));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C3));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C2));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C1));
+		Result = VectorMultiplyAdd(Z, Result, VectorSetFloat1(C0));
+		Result = VectorMultiply(Result, Result);
+		Result = VectorMultiply(Result, Result);
+		return VectorMultiply(Result, Result);
+	}
+}
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroMetasoundEnums.h"
+
+#define LOCTEXT_NAMESPACE "DattorroReverbMetasoundEnums"
+
+namespace Metasound
+{
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroDelayStorage, FEnumDattorroDelayStorage, "DattorroDelayStorage")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroDelayStorage::Float32, "DelayStorageFloat32DisplayName", "32-bit Float", "DelayStorageFloat32Tooltip", "Full precision delay memory."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroDelayStorage::Float16, "DelayStorageFloat16DisplayName", "16-bit Float", "DelayStorageFloat16Tooltip", "Half precision delay memory. Halves memory and bandwidth; precision follows the level, so tails stay clean as they decay."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroDelayStorage::Int16, "DelayStorageInt16DisplayName", "16-bit Integer", "DelayStorageInt16Tooltip", "Scaled integer delay memory. Halves memory and bandwidth; fixed noise floor, so quiet tails lose resolution."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroOutputTaps, FEnumDattorroOutputTaps, "DattorroOutputTaps")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroOutputTaps::Classic, "OutputTapsClassicDisplayName", "Classic", "OutputTapsClassicTooltip", "The original output mix of this node."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroOutputTaps::Dattorro, "OutputTapsDattorroDisplayName", "Dattorro", "OutputTapsDattorroTooltip", "The paper's 14 output taps spread across both halves of the tank. Denser, decorrelated stereo."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroDecayMode, FEnumDattorroDecayMode, "DattorroDecayMode")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroDecayMode::Rate, "DecayModeRateDisplayName", "Rate", "DecayModeRateTooltip", "The Decay Rate pin, the same at every frequency."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroDecayMode::ThreeBand, "DecayModeThreeBandDisplayName", "Three Band", "DecayModeThreeBandTooltip", "Separate low, mid and high decay times (RT60), split at the two crossover pins."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroEarlyReflections, FEnumDattorroEarlyReflections, "DattorroEarlyReflections")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroEarlyReflections::Off, "EarlyReflectionsOffDisplayName", "Off", "EarlyReflectionsOffTooltip", "No early reflections - the tank only."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroEarlyReflections::SmallRoom, "EarlyReflectionsSmallRoomDisplayName", "Small Room", "EarlyReflectionsSmallRoomTooltip", "4 x 3 x 2.5 m, 8 taps."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroEarlyReflections::MediumRoom, "EarlyReflectionsMediumRoomDisplayName", "Medium Room", "EarlyReflectionsMediumRoomTooltip", "8 x 6 x 3 m, 16 taps."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroEarlyReflections::LargeHall, "EarlyReflectionsLargeHallDisplayName", "Large Hall", "EarlyReflectionsLargeHallTooltip", "20 x 14 x 8 m, 24 taps."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroEarlyReflections::Corridor, "EarlyReflectionsCorridorDisplayName", "Corridor", "EarlyReflectionsCorridorTooltip", "30 x 2.5 x 3 m, 32 taps - dense flutter between the near walls."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroPitchShiftWindow, FEnumDattorroPitchShiftWindow, "DattorroPitchShiftWindow")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroPitchShiftWindow::Fixed, "PitchShiftWindowFixedDisplayName", "Fixed", "PitchShiftWindowFixedTooltip", "Always uses the Delay Length pin."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroPitchShiftWindow::Adaptive, "PitchShiftWindowAdaptiveDisplayName", "Adaptive", "PitchShiftWindowAdaptiveTooltip", "Shortest window for the current pitch and input (5 ms and up), capped by Delay Length. Lowest latency."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EDattorroPitchShiftAlgorithm, FEnumDattorroPitchShiftAlgorithm, "DattorroPitchShiftAlgorithm")
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroPitchShiftAlgorithm::Doppler, "PitchShiftAlgorithmDopplerDisplayName", "Doppler", "PitchShiftAlgorithmDopplerTooltip", "Two crossfaded delay taps. Cheapest, lowest latency."),
+		DEFINE_METASOUND_ENUM_ENTRY(EDattorroPitchShiftAlgorithm::PhaseVocoder, "PitchShiftAlgorithmPhaseVocoderDisplayName", "Phase Vocoder", "PitchShiftAlgorithmPhaseVocoderTooltip", "Phase locked STFT. Best quality at large shifts, for hero sounds - two FFTs per hop and ~43 ms of latency."),
+	DEFINE_METASOUND_ENUM_END()
+}
+
+#undef LOCTEXT_NAMESPACE
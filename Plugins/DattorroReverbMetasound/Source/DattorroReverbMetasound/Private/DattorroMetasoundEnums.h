@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundEnumRegistrationMacro.h"
+#include "DattorroPooledDelay.h"
+
+namespace Metasound
+{
+	// Storage format for the long delay lines, exposed as a node pin. Mirrors Audio::EDelayStorageFormat.
+	enum class EDattorroDelayStorage : int32
+	{
+		Float32 = 0,
+		Float16,
+		Int16
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroDelayStorage, EDattorroDelayStorage::Float32, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroDelayStorage, FEnumDattorroDelayStorageInfo, FEnumDattorroDelayStorageReadRef, FEnumDattorroDelayStorageWriteRef);
+
+	// Which points of the tank make up the reverb's wet output.
+	enum class EDattorroOutputTaps : int32
+	{
+		// The original mix - the feedback and final delays at their read positions plus two pre-delay taps.
+		Classic = 0,
+		// The 14 tap network from the Dattorro paper, decorrelated left and right.
+		Dattorro
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroOutputTaps, EDattorroOutputTaps::Classic, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroOutputTaps, FEnumDattorroOutputTapsInfo, FEnumDattorroOutputTapsReadRef, FEnumDattorroOutputTapsWriteRef);
+
+	// How the reverb tank sets its decay.
+	enum class EDattorroDecayMode : int32
+	{
+		// The Decay Rate pin - one gain for every frequency, with Delay Damping for the highs.
+		Rate = 0,
+		// Separate RT60s below, between and above the two crossovers.
+		ThreeBand
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroDecayMode, EDattorroDecayMode::Rate, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroDecayMode, FEnumDattorroDecayModeInfo, FEnumDattorroDecayModeReadRef, FEnumDattorroDecayModeWriteRef);
+
+	// Room the reverb's early reflections are modelled on. Picked when the node is built.
+	enum class EDattorroEarlyReflections : int32
+	{
+		Off = 0,
+		SmallRoom,
+		MediumRoom,
+		LargeHall,
+		Corridor
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroEarlyReflections, EDattorroEarlyReflections::Off, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroEarlyReflections, FEnumDattorroEarlyReflectionsInfo, FEnumDattorroEarlyReflectionsReadRef, FEnumDattorroEarlyReflectionsWriteRef);
+
+	// How the pitch shifter picks its grain window (its delay length).
+	enum class EDattorroPitchShiftWindow : int32
+	{
+		// The Delay Length pin, as is.
+		Fixed = 0,
+		// The shortest window that keeps artifacts down for the current pitch and input, capped by the Delay Length pin.
+		Adaptive
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroPitchShiftWindow, EDattorroPitchShiftWindow::Fixed, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroPitchShiftWindow, FEnumDattorroPitchShiftWindowInfo, FEnumDattorroPitchShiftWindowReadRef, FEnumDattorroPitchShiftWindowWriteRef);
+
+	// Which algorithm the pitch shifter runs. Picked when the node is built.
+	enum class EDattorroPitchShiftAlgorithm : int32
+	{
+		// Two crossfaded delay taps. Cheap and short, but smears transients at large shifts.
+		Doppler = 0,
+		// STFT phase vocoder with phase locking. Clean at large shifts, many times the cost and one FFT frame of latency.
+		PhaseVocoder
+	};
+
+	DECLARE_METASOUND_ENUM(EDattorroPitchShiftAlgorithm, EDattorroPitchShiftAlgorithm::Doppler, DATTORROREVERBMETASOUND_API,
+		FEnumDattorroPitchShiftAlgorithm, FEnumDattorroPitchShiftAlgorithmInfo, FEnumDattorroPitchShiftAlgorithmReadRef, FEnumDattorroPitchShiftAlgorithmWriteRef);
+
+	inline Audio::EDelayStorageFormat GetDelayStorageFormat(EDattorroDelayStorage InStorage)
+	{
+		switch (InStorage)
+		{
+		case EDattorroDelayStorage::Float16:
+			return Audio::EDelayStorageFormat::Float16;
+		case EDattorroDelayStorage::Int16:
+			return Audio::EDelayStorageFormat::Int16;
+		default:
+			return Audio::EDelayStorageFormat::Float32;
+		}
+	}
+}
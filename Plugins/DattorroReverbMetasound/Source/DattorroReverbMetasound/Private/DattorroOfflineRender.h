@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+struct FDattorroReverbRenderSettings;
+
+namespace Metasound
+{
+	// Runs interleaved input through a reverberation operator built from the settings, block by block as a MetaSound would,
+	// until the input is used up and the tail has died away. Defined with the operator in MetasoundReverberationNode.cpp.
+	bool RenderReverberationOffline(const FDattorroReverbRenderSettings& InSettings, TConstArrayView<float> InInterleaved, int32 InNumInputChannels, float InSampleRate, TArray<float>& OutInterleaved);
+
+	// Seconds a mono in, mono out operator at its node defaults takes to run InNumBlocks blocks of white noise, 100 blocks a
+	// second as a live MetaSound would. Only Execute() is timed. Defined with each operator - for the reverb cost comparison test.
+	double TimeReverberationBlocks(int32 InNumBlocks, float InSampleRate);
+	double TimeVelvetReverbBlocks(int32 InNumBlocks, float InSampleRate);
+
+	// Writes the same white noise to InInput before every block, so runs and operators can be compared, and returns the
+	// seconds spent in InExecute alone.
+	template<typename ExecuteType>
+	double TimeBlocksOfNoise(TArrayView<float> InInput, int32 InNumBlocks, ExecuteType&& InExecute)
+	{
+		FRandomStream Noise(0x5EED);
+		double Seconds = 0.0;
+		for (int32 Block = 0; Block < InNumBlocks; Block++)
+		{
+			for (float& Sample : InInput)
+			{
+				Sample = Noise.FRandRange(-0.5f, 0.5f);
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			InExecute();
+			Seconds += FPlatformTime::Seconds() - StartTime;
+		}
+		return Seconds;
+	}
+}
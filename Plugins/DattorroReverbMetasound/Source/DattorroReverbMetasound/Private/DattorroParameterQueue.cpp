@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroParameterQueue.h"
+#include "Misc/ScopeLock.h"
+
+namespace Audio
+{
+	static_assert(FMath::IsPowerOfTwo(FDattorroParameterQueue::Capacity), "The slot is the index masked by Capacity - 1");
+
+	bool FDattorroParameterQueue::Push(const FDattorroParameterRecord& InRecord)
+	{
+		const uint32 Write = WriteIndex.load(std::memory_order_relaxed);
+		if (Write - ReadIndex.load(std::memory_order_acquire) >= Capacity)
+		{
+			return false;
+		}
+
+		Records[Write & (Capacity - 1)] = InRecord;
+		WriteIndex.store(Write + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool FDattorroParameterQueue::Pop(FDattorroParameterRecord& OutRecord)
+	{
+		const uint32 Read = ReadIndex.load(std::memory_order_relaxed);
+		if (Read == WriteIndex.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		OutRecord = Records[Read & (Capacity - 1)];
+		ReadIndex.store(Read + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool FDattorroParameterQueue::TryClaimConsumer()
+	{
+		bool bExpected = false;
+		return bConsumerClaimed.compare_exchange_strong(bExpected, true);
+	}
+
+	void FDattorroParameterQueue::ReleaseConsumer()
+	{
+		bConsumerClaimed.store(false);
+	}
+
+	FDattorroParameterQueues& FDattorroParameterQueues::Get()
+	{
+		static FDattorroParameterQueues Instance;
+		return Instance;
+	}
+
+	TSharedRef<FDattorroParameterQueue, ESPMode::ThreadSafe> FDattorroParameterQueues::FindOrAdd(int32 InInstanceId)
+	{
+		FScopeLock Lock(&QueuesCritSec);
+
+		if (const TSharedRef<FDattorroParameterQueue, ESPMode::ThreadSafe>* Queue = Queues.Find(InInstanceId))
+		{
+			return *Queue;
+		}
+		return Queues.Add(InInstanceId, MakeShared<FDattorroParameterQueue, ESPMode::ThreadSafe>());
+	}
+
+	bool FDattorroParameterQueues::Push(const FDattorroParameterRecord& InRecord)
+	{
+		return FindOrAdd(InRecord.InstanceId)->Push(InRecord);
+	}
+
+	TSharedPtr<FDattorroParameterQueue, ESPMode::ThreadSafe> FDattorroParameterQueues::ClaimConsumer(int32 InInstanceId)
+	{
+		TSharedRef<FDattorroParameterQueue, ESPMode::ThreadSafe> Queue = FindOrAdd(InInstanceId);
+		if (!Queue->TryClaimConsumer())
+		{
+			return nullptr;
+		}
+		return Queue;
+	}
+
+	void FDattorroParameterQueues::ReleaseConsumer(FDattorroParameterQueue& InQueue)
+	{
+		InQueue.ReleaseConsumer();
+	}
+}
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroPhaseVocoder.h"
+#include "DSP/FloatArrayMath.h"
+
+namespace Audio
+{
+	namespace PhaseVocoder
+	{
+		// Peaks below this power (about -120 dB relative to a full scale sine) are left out, so silence costs no trig
+		static constexpr float PeakPowerFloor = 1.0e-12f * FPhaseVocoderPitchShifter::FFTSize * FPhaseVocoderPitchShifter::FFTSize;
+
+		// Phase a bin's centre frequency advances by in one hop
+		static constexpr float BinPhaseAdvance = 2.0f * PI * FPhaseVocoderPitchShifter::HopSize / FPhaseVocoderPitchShifter::FFTSize;
+
+		// Gain an FFT scaling mode applies, relative to the unnormalised transform
+		static float GetScalingGain(const EFFTScaling InScaling, const float InFFTSize)
+		{
+			switch (InScaling)
+			{
+			case EFFTScaling::MultipliedByFFTSize:
+				return InFFTSize;
+			case EFFTScaling::MultipliedBySqrtFFTSize:
+				return FMath::Sqrt(InFFTSize);
+			case EFFTScaling::DividedByFFTSize:
+				return 1.0f / InFFTSize;
+			case EFFTScaling::DividedBySqrtFFTSize:
+				return 1.0f / FMath::Sqrt(InFFTSize);
+			default:
+				return 1.0f;
+			}
+		}
+
+		static FORCEINLINE float WrapPhase(const float InPhase)
+		{
+			return InPhase - 2.0f * PI * FMath::RoundToFloat(InPhase / (2.0f * PI));
+		}
+	}
+
+	FPhaseVocoderPitchShifter::FPhaseVocoderPitchShifter()
+	{
+		using namespace PhaseVocoder;
+
+		FFFTSettings Settings;
+		Settings.Log2Size = Log2FFTSize;
+		Settings.bArrays128BitAligned = true;
+		Settings.bEnableHardwareAcceleration = true;
+
+		if (!FFFTFactory::AreFFTSettingsSupported(Settings))
+		{
+			return;
+		}
+		FFT = FFFTFactory::NewFFTAlgorithm(Settings);
+		if (!FFT.IsValid())
+		{
+			return;
+		}
+
+		// A periodic Hann window squared sums to 3/8 * Overlap across overlapping hops.
+		// The synthesis side undoes that and whatever scaling the FFT round trip applies.
+		const float OverlapGain = 0.375f * Overlap;
+		const float RoundTripGain = FFTSize * GetScalingGain(FFT->ForwardScaling(), FFTSize) * GetScalingGain(FFT->InverseScaling(), FFTSize);
+		const float SynthesisGain = 1.0f / (OverlapGain * RoundTripGain);
+
+		AnalysisWindow.SetNumUninitialized(FFTSize);
+		SynthesisWindow.SetNumUninitialized(FFTSize);
+		for (int32 Index = 0; Index < FFTSize; ++Index)
+		{
+			const float Hann = 0.5f - 0.5f * FMath::Cos(2.0f * PI * Index / FFTSize);
+			AnalysisWindow[Index] = Hann;
+			SynthesisWindow[Index] = Hann * SynthesisGain;
+		}
+
+		InputFrame.SetNumZeroed(FFTSize);
+		TimeFrame.SetNumZeroed(FFTSize);
+		OutputAccumulator.SetNumZeroed(FFTSize);
+
+		for (FAlignedFloatBuffer* ComplexBuffer : { &Spectrum, &PreviousSpectrum, &ShiftedSpectrum, &PreviousShiftedSpectrum })
+		{
+			ComplexBuffer->SetNumZeroed(2 * NumBins);
+		}
+		Power.SetNumZeroed(NumBins);
+
+		Peaks.Reserve(NumBins / 2);
+	}
+
+	void FPhaseVocoderPitchShifter::Reset()
+	{
+		for (FAlignedFloatBuffer* Buffer : { &InputFrame, &OutputAccumulator, &PreviousSpectrum, &PreviousShiftedSpectrum })
+		{
+			FMemory::Memzero(Buffer->GetData(), Buffer->Num() * sizeof(float));
+		}
+		HopFill = 0;
+	}
+
+	void FPhaseVocoderPitchShifter::ProcessBlock(TArrayView<const float> InSamples, TArrayView<float> OutSamples, const float InPitchRatio)
+	{
+		check(InSamples.Num() == OutSamples.Num());
+
+		if (!IsValid())
+		{
+			FMemory::Memzero(OutSamples.GetData(), OutSamples.Num() * sizeof(float));
+			return;
+		}
+
+		// Copy in and out up to the next hop boundary at a time, transforming at every boundary
+		int32 FrameIndex = 0;
+		while (FrameIndex < InSamples.Num())
+		{
+			const int32 NumToCopy = FMath::Min(InSamples.Num() - FrameIndex, HopSize - HopFill);
+			FMemory::Memcpy(&InputFrame[FFTSize - HopSize + HopFill], &InSamples[FrameIndex], NumToCopy * sizeof(float));
+			FMemory::Memcpy(&OutSamples[FrameIndex], &OutputAccumulator[HopFill], NumToCopy * sizeof(float));
+
+			HopFill += NumToCopy;
+			FrameIndex += NumToCopy;
+
+			if (HopFill == HopSize)
+			{
+				ProcessHop(InPitchRatio);
+				HopFill = 0;
+			}
+		}
+	}
+
+	void FPhaseVocoderPitchShifter::ProcessHop(const float InPitchRatio)
+	{
+		using namespace PhaseVocoder;
+
+		// ---------- Analysis ----------
+
+		FMemory::Memcpy(TimeFrame.GetData(), InputFrame.GetData(), FFTSize * sizeof(float));
+		ArrayMultiplyInPlace(AnalysisWindow, TimeFrame);
+		FFT->ForwardRealToComplex(TimeFrame.GetData(), Spectrum.GetData());
+		ArrayComplexToPower(Spectrum, Power);
+
+		// The oldest hop has been analysed for the last time
+		FMemory::Memmove(InputFrame.GetData(), &InputFrame[HopSize], (FFTSize - HopSize) * sizeof(float));
+
+		// ---------- Peaks ----------
+
+		// A peak is louder than two bins either side - a Hann main lobe is four bins wide, so this skips most sidelobe ripple
+		Peaks.Reset();
+		for (int32 Bin = 2; Bin < NumBins - 2; ++Bin)
+		{
+			const float BinPower = Power[Bin];
+			if (BinPower > PeakPowerFloor
+				&& BinPower > Power[Bin - 1] && BinPower > Power[Bin - 2]
+				&& BinPower >= Power[Bin + 1] && BinPower >= Power[Bin + 2])
+			{
+				Peaks.Add(Bin);
+			}
+		}
+
+		// ---------- Shift Regions ----------
+
+		FMemory::Memzero(ShiftedSpectrum.GetData(), ShiftedSpectrum.Num() * sizeof(float));
+
+		for (int32 PeakIndex = 0; PeakIndex < Peaks.Num(); ++PeakIndex)
+		{
+			const int32 Peak = Peaks[PeakIndex];
+			const int32 ShiftBins = FMath::RoundToInt(Peak * (InPitchRatio - 1.0f));
+			const int32 ShiftedPeak = Peak + ShiftBins;
+			if (ShiftedPeak < 0 || ShiftedPeak >= NumBins)
+			{
+				continue;
+			}
+
+			// The peak's true frequency, as its phase advance over the hop (the deviation from the bin centre is wrapped first)
+			const float Re = Spectrum[2 * Peak];
+			const float Im = Spectrum[2 * Peak + 1];
+			const float PreviousRe = PreviousSpectrum[2 * Peak];
+			const float PreviousIm = PreviousSpectrum[2 * Peak + 1];
+			const float PhaseDelta = FMath::Atan2(Im * PreviousRe - Re * PreviousIm, Re * PreviousRe + Im * PreviousIm);
+			const float PhaseAdvance = Peak * BinPhaseAdvance + WrapPhase(PhaseDelta - Peak * BinPhaseAdvance);
+
+			// Continue the shifted peak's phase from the last hop's output, advanced at the shifted frequency.
+			// A peak with nothing under it last hop starts from its own analysis phase.
+			float Rotation = 0.0f;
+			const float PreviousShiftedRe = PreviousShiftedSpectrum[2 * ShiftedPeak];
+			const float PreviousShiftedIm = PreviousShiftedSpectrum[2 * ShiftedPeak + 1];
+			if (PreviousShiftedRe * PreviousShiftedRe + PreviousShiftedIm * PreviousShiftedIm > PeakPowerFloor)
+			{
+				const float SynthesisPhase = FMath::Atan2(PreviousShiftedIm, PreviousShiftedRe) + InPitchRatio * PhaseAdvance;
+				Rotation = SynthesisPhase - FMath::Atan2(Im, Re);
+			}
+
+			float RotationSin = 0.0f;
+			float RotationCos = 1.0f;
+			FMath::SinCos(&RotationSin, &RotationCos, Rotation);
+
+			// The region runs half way to the neighbouring peaks. Every bin in it moves and rotates with the peak.
+			const int32 RegionStart = PeakIndex == 0 ? 0 : (Peaks[PeakIndex - 1] + Peak + 1) / 2;
+			const int32 RegionEnd = PeakIndex == Peaks.Num() - 1 ? NumBins : (Peak + Peaks[PeakIndex + 1] + 1) / 2;
+			const int32 FirstBin = FMath::Max(RegionStart, -ShiftBins);
+			const int32 LastBin = FMath::Min(RegionEnd, NumBins - ShiftBins);
+
+			for (int32 Bin = FirstBin; Bin < LastBin; ++Bin)
+			{
+				const float BinRe = Spectrum[2 * Bin];
+				const float BinIm = Spectrum[2 * Bin + 1];
+				const int32 ShiftedBin = Bin + ShiftBins;
+				ShiftedSpectrum[2 * ShiftedBin] += BinRe * RotationCos - BinIm * RotationSin;
+				ShiftedSpectrum[2 * ShiftedBin + 1] += BinRe * RotationSin + BinIm * RotationCos;
+			}
+		}
+
+		// DC and Nyquist are real
+		ShiftedSpectrum[1] = 0.0f;
+		ShiftedSpectrum[2 * NumBins - 1] = 0.0f;
+
+		FMemory::Memcpy(PreviousSpectrum.GetData(), Spectrum.GetData(), Spectrum.Num() * sizeof(float));
+		FMemory::Memcpy(PreviousShiftedSpectrum.GetData(), ShiftedSpectrum.GetData(), ShiftedSpectrum.Num() * sizeof(float));
+
+		// ---------- Synthesis ----------
+
+		FFT->InverseComplexToReal(ShiftedSpectrum.GetData(), TimeFrame.GetData());
+		ArrayMultiplyInPlace(SynthesisWindow, TimeFrame);
+
+		// Drop the hop that was just output and overlap-add the new frame
+		FMemory::Memmove(OutputAccumulator.GetData(), &OutputAccumulator[HopSize], (FFTSize - HopSize) * sizeof(float));
+		FMemory::Memzero(&OutputAccumulator[FFTSize - HopSize], HopSize * sizeof(float));
+		ArrayMixIn(TimeFrame, OutputAccumulator);
+	}
+}
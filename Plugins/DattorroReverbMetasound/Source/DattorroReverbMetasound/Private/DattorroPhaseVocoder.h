@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSP/AlignedBuffer.h"
+#include "DSP/FFTAlgorithm.h"
+
+namespace Audio
+{
+	/// Summary
+	///
+	/// STFT phase vocoder pitch shifter with identity phase locking (Laroche and Dolson, "New phase-vocoder techniques for pitch-shifting", 1999).
+	/// Each hop the spectrum is split into regions around its magnitude peaks. Every region is moved by a whole number of bins
+	/// to its peak's shifted frequency and rotated by one phase, chosen to continue the peak's phase from the last hop,
+	/// so the bins around a peak keep their phase relations (no "phasiness") and only peaks need any trig.
+	///
+	/// Every buffer, the windows and the FFT (SIMD where the platform has it) are set up in the constructor;
+	/// ProcessBlock never allocates and accepts any block size.
+	/// The latency is one FFT frame.
+	///
+	/// Summary
+	class FPhaseVocoderPitchShifter
+	{
+	public:
+		// 2048 points at 48 kHz is ~43 ms - long enough to resolve partials down to the low male voice range.
+		static constexpr int32 Log2FFTSize = 11;
+		static constexpr int32 FFTSize = 1 << Log2FFTSize;
+		static constexpr int32 NumBins = FFTSize / 2 + 1;
+		static constexpr int32 Overlap = 4;
+		static constexpr int32 HopSize = FFTSize / Overlap;
+
+		FPhaseVocoderPitchShifter();
+
+		// False if the platform could not supply an FFT of this size.
+		bool IsValid() const { return FFT.IsValid(); }
+
+		int32 GetLatencySamples() const { return FFTSize; }
+
+		// Clears the analysis and overlap-add state.
+		void Reset();
+
+		// Pitch shifts a block by InPitchRatio (output frequency / input frequency). In and out may not alias.
+		void ProcessBlock(TArrayView<const float> InSamples, TArrayView<float> OutSamples, const float InPitchRatio);
+
+	private:
+		void ProcessHop(const float InPitchRatio);
+
+		TUniquePtr<IFFTAlgorithm> FFT;
+
+		// Periodic Hann windows. The synthesis window also carries the overlap-add and FFT round trip normalisation.
+		FAlignedFloatBuffer AnalysisWindow;
+		FAlignedFloatBuffer SynthesisWindow;
+
+		// The last FFTSize input samples, the newest hop at the end
+		FAlignedFloatBuffer InputFrame;
+		FAlignedFloatBuffer TimeFrame;
+
+		// Interleaved complex spectra (NumBins pairs): this hop's and the last hop's analysis, and the shifted output
+		FAlignedFloatBuffer Spectrum;
+		FAlignedFloatBuffer PreviousSpectrum;
+		FAlignedFloatBuffer ShiftedSpectrum;
+		FAlignedFloatBuffer PreviousShiftedSpectrum;
+		FAlignedFloatBuffer Power;
+
+		// Overlap-add accumulator. The first HopSize samples are the next output.
+		FAlignedFloatBuffer OutputAccumulator;
+
+		// Bins of this hop's magnitude peaks, reserved for the worst case (every other bin)
+		TArray<int32> Peaks;
+
+		// Samples of the current hop already taken in (and given out)
+		int32 HopFill = 0;
+	};
+}
@@ -0,0 +1,252 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroPooledDelay.h"
+#include "DattorroSampleConversion.h"
+
+namespace Audio
+{
+	FPooledDelay::~FPooledDelay()
+	{
+		Release();
+	}
+
+	void FPooledDelay::Init(const float InSampleRate, const float InBufferLengthSec, const EDelayStorageFormat InStorageFormat)
+	{
+		// Re-initialising a held line would leave the block the wrong size.
+		Release();
+
+		SampleRate = InSampleRate;
+		StorageFormat = InStorageFormat;
+		AudioBufferSize = FMath::Max((int32)(InBufferLengthSec * InSampleRate) + 1, 1);
+		ReadIndex = 0;
+		WriteIndex = 0;
+		DelayInSamples = FMath::Min(DelayInSamples, (float)(AudioBufferSize - 1));
+	}
+
+	bool FPooledDelay::Acquire()
+	{
+		if (!Block.IsValid())
+		{
+			Block = FDelayBlockPool::Get().Acquire(GetRequiredBytes());
+			AudioBuffer = Block.Data;
+			WriteIndex = 0;
+			UpdateReadIndex();
+		}
+		return Block.IsValid();
+	}
+
+	void FPooledDelay::Release()
+	{
+		FDelayBlockPool::Get().Release(Block);
+		AudioBuffer = nullptr;
+	}
+
+	void FPooledDelay::Reset()
+	{
+		// All zero bits is 0.0 in every storage format
+		if (AudioBuffer)
+		{
+			FMemory::Memzero(AudioBuffer, GetRequiredBytes());
+		}
+		WriteIndex = 0;
+		UpdateReadIndex();
+	}
+
+	void FPooledDelay::SetDelaySamples(const float InDelaySamples)
+	{
+		DelayInSamples = FMath::Clamp(InDelaySamples, 0.0f, (float)(AudioBufferSize - 1));
+		UpdateReadIndex();
+	}
+
+	void FPooledDelay::UpdateReadIndex()
+	{
+		ReadIndex = WriteIndex - (int32)DelayInSamples;
+		if (ReadIndex < 0)
+		{
+			ReadIndex += AudioBufferSize;
+		}
+	}
+
+	float FPooledDelay::Read() const
+	{
+		if (!AudioBuffer)
+		{
+			return 0.0f;
+		}
+
+		// Interpolate between the read position and the sample before it for the fractional part of the delay
+		const float Yn = LoadSample(ReadIndex);
+		const int32 ReadIndexPrev = (ReadIndex - 1 < 0) ? AudioBufferSize - 1 : ReadIndex - 1;
+		const float YnPrev = LoadSample(ReadIndexPrev);
+
+		const float Fraction = DelayInSamples - (int32)DelayInSamples;
+		return FMath::Lerp(Yn, YnPrev, Fraction);
+	}
+
+	float FPooledDelay::ReadDelayAt(const float InReadMsec) const
+	{
+		return ReadDelaySamples(InReadMsec * SampleRate * 0.001f);
+	}
+
+	float FPooledDelay::ReadDelaySamples(const float InDelaySamples) const
+	{
+		if (!AudioBuffer)
+		{
+			return 0.0f;
+		}
+
+		const float ReadDelay = FMath::Clamp(InDelaySamples, 0.0f, (float)(AudioBufferSize - 1));
+		const int32 WholeDelay = (int32)ReadDelay;
+		const float Fraction = ReadDelay - WholeDelay;
+
+		int32 ReadIndexA = WriteIndex - WholeDelay;
+		if (ReadIndexA < 0)
+		{
+			ReadIndexA += AudioBufferSize;
+		}
+		const int32 ReadIndexB = (ReadIndexA - 1 < 0) ? AudioBufferSize - 1 : ReadIndexA - 1;
+
+		return FMath::Lerp(LoadSample(ReadIndexA), LoadSample(ReadIndexB), Fraction);
+	}
+
+	template<typename SampleLoaderType>
+	void FPooledDelay::ReadDelaySamplesBlockImpl(TArrayView<const float> InDelaySamples, TArrayView<float> OutSamples, SampleLoaderType LoadSampleAt) const
+	{
+		const float MaxDelay = (float)(AudioBufferSize - 1);
+		for (int32 Index = 0; Index < InDelaySamples.Num(); ++Index)
+		{
+			const float ReadDelay = FMath::Clamp(InDelaySamples[Index], 0.0f, MaxDelay);
+			const int32 WholeDelay = (int32)ReadDelay;
+			const float Fraction = ReadDelay - WholeDelay;
+
+			int32 ReadIndexA = WriteIndex - WholeDelay;
+			if (ReadIndexA < 0)
+			{
+				ReadIndexA += AudioBufferSize;
+			}
+			const int32 ReadIndexB = (ReadIndexA - 1 < 0) ? AudioBufferSize - 1 : ReadIndexA - 1;
+
+			const float SampleA = LoadSampleAt(ReadIndexA);
+			OutSamples[Index] = SampleA + Fraction * (LoadSampleAt(ReadIndexB) - SampleA);
+		}
+	}
+
+	void FPooledDelay::ReadDelaySamplesBlock(TArrayView<const float> InDelaySamples, TArrayView<float> OutSamples) const
+	{
+		check(InDelaySamples.Num() == OutSamples.Num());
+
+		if (!AudioBuffer)
+		{
+			FMemory::Memzero(OutSamples.GetData(), OutSamples.Num() * sizeof(float));
+			return;
+		}
+
+		switch (StorageFormat)
+		{
+		case EDelayStorageFormat::Float16:
+		{
+			const uint16* Samples = static_cast<const uint16*>(AudioBuffer);
+			ReadDelaySamplesBlockImpl(InDelaySamples, OutSamples, [Samples](int32 InIndex) { return FPlatformMath::LoadHalf(&Samples[InIndex]); });
+			break;
+		}
+		case EDelayStorageFormat::Int16:
+		{
+			const int16* Samples = static_cast<const int16*>(AudioBuffer);
+			ReadDelaySamplesBlockImpl(InDelaySamples, OutSamples, [Samples](int32 InIndex) { return Samples[InIndex] * (Int16Headroom / 32767.0f); });
+			break;
+		}
+		default:
+		{
+			const float* Samples = static_cast<const float*>(AudioBuffer);
+			ReadDelaySamplesBlockImpl(InDelaySamples, OutSamples, [Samples](int32 InIndex) { return Samples[InIndex]; });
+			break;
+		}
+		}
+	}
+
+	void FPooledDelay::WriteDelayAndInc(const float InDelayInput)
+	{
+		if (!AudioBuffer)
+		{
+			return;
+		}
+
+		StoreSample(WriteIndex, InDelayInput);
+
+		WriteIndex = (WriteIndex + 1 < AudioBufferSize) ? WriteIndex + 1 : 0;
+		ReadIndex = (ReadIndex + 1 < AudioBufferSize) ? ReadIndex + 1 : 0;
+	}
+
+	void FPooledDelay::WriteBlock(TArrayView<const float> InSamples)
+	{
+		if (!AudioBuffer)
+		{
+			return;
+		}
+
+		// A block longer than the line only leaves its last AudioBufferSize samples behind
+		int32 NumToWrite = InSamples.Num();
+		if (NumToWrite > AudioBufferSize)
+		{
+			WriteIndex = (WriteIndex + (NumToWrite - AudioBufferSize)) % AudioBufferSize;
+			InSamples = InSamples.Right(AudioBufferSize);
+			NumToWrite = AudioBufferSize;
+		}
+
+		// Write in at most two contiguous runs, either side of the wrap
+		int32 SourceOffset = 0;
+		while (NumToWrite > 0)
+		{
+			const int32 RunLength = FMath::Min(NumToWrite, AudioBufferSize - WriteIndex);
+			TArrayView<const float> Run = InSamples.Slice(SourceOffset, RunLength);
+
+			switch (StorageFormat)
+			{
+			case EDelayStorageFormat::Float16:
+				ArrayFloatToHalf(Run, TArrayView<uint16>(static_cast<uint16*>(AudioBuffer) + WriteIndex, RunLength));
+				break;
+			case EDelayStorageFormat::Int16:
+				ArrayFloatToScaledInt16(Run, 32767.0f / Int16Headroom, TArrayView<int16>(static_cast<int16*>(AudioBuffer) + WriteIndex, RunLength));
+				break;
+			default:
+				FMemory::Memcpy(static_cast<float*>(AudioBuffer) + WriteIndex, Run.GetData(), RunLength * sizeof(float));
+				break;
+			}
+
+			WriteIndex = (WriteIndex + RunLength) % AudioBufferSize;
+			SourceOffset += RunLength;
+			NumToWrite -= RunLength;
+		}
+
+		UpdateReadIndex();
+	}
+
+	float FPooledDelay::ProcessAudioSample(const float InAudio)
+	{
+		if (DelayInSamples == 0.0f)
+		{
+			return InAudio;
+		}
+
+		const float Yn = Read();
+		WriteDelayAndInc(InAudio);
+		return Yn;
+	}
+
+	float FPooledDelayAPF::ProcessAudioSample(const float InAudio)
+	{
+		// w(n) = x(n) + g * w(n - D), y(n) = -g * w(n) + w(n - D)
+		const float WnD = Read();
+		const float Wn = InAudio + G * WnD;
+		WriteDelayAndInc(Wn);
+		return -G * Wn + WnD;
+	}
+
+	float FPooledDelayAPF::ProcessAudioSampleAt(const float InAudio, const float InDelaySamples)
+	{
+		const float WnD = ReadDelaySamples(InDelaySamples);
+		const float Wn = InAudio + G * WnD;
+		WriteDelayAndInc(Wn);
+		return -G * Wn + WnD;
+	}
+}
@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DattorroDelayPool.h"
+
+namespace Audio
+{
+	// How a delay line stores its samples.
+	enum class EDelayStorageFormat : uint8
+	{
+		// Full precision, 4 bytes per sample.
+		Float32,
+		// IEEE half precision, 2 bytes per sample. Precision follows the level, so it suits decaying tails.
+		Float16,
+		// Scaled int16, 2 bytes per sample. Fixed noise floor, so quiet tails lose resolution.
+		Int16
+	};
+
+	/// Summary
+	///
+	/// Drop-in replacement for Audio::FDelay whose memory comes from FDelayBlockPool.
+	/// Init() only records the buffer length - no memory is held until Acquire() is called,
+	/// and Release() hands the memory back so a silent operator costs nothing but its members.
+	/// While released, reads return silence and writes are dropped.
+	///
+	/// The samples can optionally be kept in a 16 bit format, halving the memory and cache traffic of long lines.
+	/// Reads convert one sample at a time (their positions are scattered, even in a block read); only WriteBlock() converts whole runs with SIMD.
+	///
+	/// Summary
+	class FPooledDelay
+	{
+	public:
+		// Signals stored as int16 are scaled so that +/- Int16Headroom maps to full scale (tank signals can exceed unity).
+		static constexpr float Int16Headroom = 4.0f;
+
+		FPooledDelay() = default;
+		virtual ~FPooledDelay();
+
+		// Blocks are owned by exactly one delay line.
+		FPooledDelay(const FPooledDelay&) = delete;
+		FPooledDelay& operator=(const FPooledDelay&) = delete;
+
+		// Sets the sample rate, the length of the buffer (same arguments as Audio::FDelay::Init) and the storage format. Does not allocate.
+		void Init(const float InSampleRate, const float InBufferLengthSec = 2.0f, const EDelayStorageFormat InStorageFormat = EDelayStorageFormat::Float32);
+
+		// Takes a zeroed block from the pool. Returns false if the pool could not supply one.
+		bool Acquire();
+
+		// Returns the block to the pool.
+		void Release();
+
+		bool IsAcquired() const { return Block.IsValid(); }
+
+		// Clears the buffer in place, keeping the memory.
+		void Reset();
+
+		// Sets the delay in samples, clamped to the buffer length.
+		void SetDelaySamples(const float InDelaySamples);
+
+		float GetDelayLengthSamples() const { return DelayInSamples; }
+
+		int32 GetBufferLengthSamples() const { return AudioBufferSize; }
+
+		EDelayStorageFormat GetStorageFormat() const { return StorageFormat; }
+
+		// Number of bytes this line takes from the pool while acquired.
+		int32 GetRequiredBytes() const { return AudioBufferSize * GetBytesPerSample(); }
+
+		// Reads the delay line at the current delay length.
+		float Read() const;
+
+		// Reads the delay line at an arbitrary delay given in milliseconds (same convention as Audio::FDelay).
+		float ReadDelayAt(const float InReadMsec) const;
+
+		// Reads the delay line at an arbitrary, fractional delay given in samples behind the write position.
+		float ReadDelaySamples(const float InDelaySamples) const;
+
+		// Reads the sample a whole InDelaySamples (1 to buffer length - 1) behind the write position, with no interpolation.
+		// Only valid while acquired - meant for fixed output taps read every sample.
+		FORCEINLINE float ReadTap(const int32 InDelaySamples) const
+		{
+			int32 TapIndex = WriteIndex - InDelaySamples;
+			if (TapIndex < 0)
+			{
+				TapIndex += AudioBufferSize;
+			}
+			return LoadSample(TapIndex);
+		}
+
+		// Reads a block of fractional delays (in samples behind the write position), one per output sample.
+		// Same result as calling ReadDelaySamples() for each, with the storage format resolved once per block instead of per read.
+		void ReadDelaySamplesBlock(TArrayView<const float> InDelaySamples, TArrayView<float> OutSamples) const;
+
+		// Writes a sample into the delay line and advances the read and write positions.
+		void WriteDelayAndInc(const float InDelayInput);
+
+		// Writes a whole block, converting it to the storage format with SIMD, and advances the read and write positions.
+		void WriteBlock(TArrayView<const float> InSamples);
+
+		// Reads the delayed output, writes the input and returns the output.
+		virtual float ProcessAudioSample(const float InAudio);
+
+	protected:
+		void UpdateReadIndex();
+
+		template<typename SampleLoaderType>
+		void ReadDelaySamplesBlockImpl(TArrayView<const float> InDelaySamples, TArrayView<float> OutSamples, SampleLoaderType LoadSampleAt) const;
+
+		int32 GetBytesPerSample() const { return StorageFormat == EDelayStorageFormat::Float32 ? sizeof(float) : sizeof(uint16); }
+
+		FORCEINLINE float LoadSample(const int32 InIndex) const
+		{
+			switch (StorageFormat)
+			{
+			case EDelayStorageFormat::Float16:
+				return FPlatformMath::LoadHalf(&static_cast<const uint16*>(AudioBuffer)[InIndex]);
+			case EDelayStorageFormat::Int16:
+				return static_cast<const int16*>(AudioBuffer)[InIndex] * (Int16Headroom / 32767.0f);
+			default:
+				return static_cast<const float*>(AudioBuffer)[InIndex];
+			}
+		}
+
+		FORCEINLINE void StoreSample(const int32 InIndex, const float InValue)
+		{
+			switch (StorageFormat)
+			{
+			case EDelayStorageFormat::Float16:
+				FPlatformMath::StoreHalf(&static_cast<uint16*>(AudioBuffer)[InIndex], InValue);
+				break;
+			case EDelayStorageFormat::Int16:
+				static_cast<int16*>(AudioBuffer)[InIndex] = (int16)FMath::Clamp(FMath::RoundToInt(InValue * (32767.0f / Int16Headroom)), -32768, 32767);
+				break;
+			default:
+				static_cast<float*>(AudioBuffer)[InIndex] = InValue;
+				break;
+			}
+		}
+
+		FDelayBlock Block;
+		void* AudioBuffer = nullptr;
+
+		EDelayStorageFormat StorageFormat = EDelayStorageFormat::Float32;
+
+		int32 AudioBufferSize = 0;
+		int32 ReadIndex = 0;
+		int32 WriteIndex = 0;
+
+		float SampleRate = 0.0f;
+		float DelayInSamples = 0.0f;
+	};
+
+	// Pooled equivalent of Audio::FDelayAPF - a delay based all pass filter.
+	class FPooledDelayAPF : public FPooledDelay
+	{
+	public:
+		void SetG(const float InG) { G = InG; }
+
+		virtual float ProcessAudioSample(const float InAudio) override;
+
+		// Same as ProcessAudioSample, but reads the feedback at a fractional delay (in samples) given for this sample - used for modulated all pass filters.
+		float ProcessAudioSampleAt(const float InAudio, const float InDelaySamples);
+
+	private:
+		float G = 0.0f;
+	};
+}
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Audio
+{
+	/// Summary
+	///
+	/// Sine / cosine LFO driven by a rotation recurrence instead of per sample trig calls.
+	/// Each sample rotates the (cos, sin) pair by a fixed angle - four multiplies and two adds.
+	/// The amplitude is pulled back to 1 once per block so rounding never makes it drift.
+	///
+	/// Summary
+	class FQuadratureOscillator
+	{
+	public:
+		// Sets the oscillator frequency. Only call when the frequency changes - this is the one place trig is evaluated.
+		void SetFrequency(const float InFrequency, const float InSampleRate)
+		{
+			FMath::SinCos(&RotationSin, &RotationCos, UE_TWO_PI * InFrequency / InSampleRate);
+		}
+
+		// Writes the next InNumFrames sine and cosine values, scaled by InAmplitude.
+		void GenerateBlock(float* OutSin, float* OutCos, const int32 InNumFrames, const float InAmplitude)
+		{
+			for (int32 FrameIndex = 0; FrameIndex < InNumFrames; ++FrameIndex)
+			{
+				OutSin[FrameIndex] = InAmplitude * Sin;
+				OutCos[FrameIndex] = InAmplitude * Cos;
+
+				const float NextCos = Cos * RotationCos - Sin * RotationSin;
+				Sin = Sin * RotationCos + Cos * RotationSin;
+				Cos = NextCos;
+			}
+
+			// First order correction back onto the unit circle: 1/sqrt(x) ~= (3 - x) / 2 near x = 1
+			const float Correction = 0.5f * (3.0f - (Sin * Sin + Cos * Cos));
+			Sin *= Correction;
+			Cos *= Correction;
+		}
+
+	private:
+		float Sin = 0.0f;
+		float Cos = 1.0f;
+
+		float RotationSin = 0.0f;
+		float RotationCos = 1.0f;
+	};
+}
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DattorroReverbMetasound.h"
+#include "DattorroDelayPool.h"
 
 #define LOCTEXT_NAMESPACE "FDattorroReverbMetasoundModule"
 
@@ -15,6 +16,8 @@ void FDattorroReverbMetasoundModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 	
+	// Free the idle delay blocks kept around for reuse by the reverb operators.
+	Audio::FDelayBlockPool::Get().Trim();
 }
 
 #undef LOCTEXT_NAMESPACE
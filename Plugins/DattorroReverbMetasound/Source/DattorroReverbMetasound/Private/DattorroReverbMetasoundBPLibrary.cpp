@@ -2,6 +2,21 @@
 
 #include "DattorroReverbMetasoundBPLibrary.h"
 #include "DattorroReverbMetasound.h"
+#include "DattorroOfflineRender.h"
+#include "Async/Async.h"
+#include "DSP/Dsp.h"
+#include "DSP/FloatArrayMath.h"
+#include "Sound/SoundWave.h"
+
+#if WITH_EDITOR
+#include "Audio.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogDattorroReverbRender, Log, All);
 
 UDattorroReverbMetasoundBPLibrary::UDattorroReverbMetasoundBPLibrary(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
@@ -14,3 +29,113 @@ float UDattorroReverbMetasoundBPLibrary::DattorroReverbMetasoundSampleFunction(f
 	return -1;
 }
 
+bool UDattorroReverbMetasoundBPLibrary::RenderReverb(TConstArrayView<float> InInterleavedPCM, int32 InNumChannels, int32 InSampleRate, const FDattorroReverbRenderSettings& InSettings, TArray<float>& OutInterleavedPCM)
+{
+	if (InNumChannels <= 0)
+	{
+		return false;
+	}
+	return Metasound::RenderReverberationOffline(InSettings, InInterleavedPCM, InNumChannels, (float)InSampleRate, OutInterleavedPCM);
+}
+
+void UDattorroReverbMetasoundBPLibrary::RenderReverbPCM(const TArray<float>& InterleavedPCM, int32 NumChannels, int32 SampleRate, const FDattorroReverbRenderSettings& Settings, FOnDattorroReverbPCMRendered OnRendered)
+{
+	// The task works on its own copy of the source, so the caller's array is free as soon as this returns
+	Async(EAsyncExecution::ThreadPool, [Source = InterleavedPCM, NumChannels, SampleRate, Settings, OnRendered]()
+	{
+		TArray<float> Rendered;
+		const bool bSuccess = RenderReverb(Source, NumChannels, SampleRate, Settings, Rendered);
+		if (!bSuccess)
+		{
+			UE_LOG(LogDattorroReverbRender, Warning, TEXT("Could not render %d channel audio to %d channels"), NumChannels, Settings.NumOutputChannels);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [bSuccess, Rendered = MoveTemp(Rendered), OnRendered]()
+		{
+			OnRendered.ExecuteIfBound(bSuccess, Rendered);
+		});
+	});
+}
+
+void UDattorroReverbMetasoundBPLibrary::RenderReverbToSoundWave(USoundWave* SourceWave, const FDattorroReverbRenderSettings& Settings, const FString& PackagePath, const FString& AssetName, FOnDattorroReverbSoundWaveRendered OnRendered)
+{
+#if WITH_EDITOR
+	TArray<uint8> SourcePCMBytes;
+	uint32 SampleRate = 0;
+	uint16 NumChannels = 0;
+	if (SourceWave == nullptr || !SourceWave->GetImportedSoundWaveData(SourcePCMBytes, SampleRate, NumChannels) || NumChannels == 0)
+	{
+		UE_LOG(LogDattorroReverbRender, Warning, TEXT("%s has no imported audio to render"), *GetNameSafe(SourceWave));
+		OnRendered.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	// The imported audio is 16-bit - converted on the game thread so the task never touches the source asset
+	TArray<float> Source;
+	Source.SetNumUninitialized(SourcePCMBytes.Num() / sizeof(int16));
+	Audio::ArrayPcm16ToFloat(MakeArrayView(reinterpret_cast<const int16*>(SourcePCMBytes.GetData()), Source.Num()), Source);
+
+	Async(EAsyncExecution::ThreadPool, [Source = MoveTemp(Source), NumChannels, SampleRate, Settings, PackagePath, AssetName, OnRendered]()
+	{
+		TArray<float> Rendered;
+		const bool bSuccess = RenderReverb(Source, NumChannels, SampleRate, Settings, Rendered);
+
+		TArray<int16> RenderedPCM;
+		if (bSuccess)
+		{
+			// A tail can build past full scale - scaled down as a whole rather than clipped into 16-bit
+			const float Peak = Audio::ArrayMaxAbsValue(Rendered);
+			if (Peak > 1.0f)
+			{
+				UE_LOG(LogDattorroReverbRender, Warning, TEXT("%s peaks at %.1f dBFS - normalized to 0 dBFS"), *AssetName, Audio::ConvertToDecibels(Peak));
+				Audio::ArrayMultiplyByConstantInPlace(Rendered, 1.0f / Peak);
+			}
+			RenderedPCM.SetNumUninitialized(Rendered.Num());
+			Audio::ArrayFloatToPcm16(Rendered, RenderedPCM);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [bSuccess, RenderedPCM = MoveTemp(RenderedPCM), SampleRate, Settings, PackagePath, AssetName, OnRendered]()
+		{
+			if (!bSuccess)
+			{
+				UE_LOG(LogDattorroReverbRender, Warning, TEXT("Could not render %s - unsupported channel count"), *AssetName);
+				OnRendered.ExecuteIfBound(nullptr);
+				return;
+			}
+
+			const int32 NumOutputChannels = Settings.NumOutputChannels;
+			const int32 NumFrames = RenderedPCM.Num() / NumOutputChannels;
+
+			UPackage* Package = CreatePackage(*FPaths::Combine(PackagePath, AssetName));
+			USoundWave* RenderedWave = NewObject<USoundWave>(Package, *AssetName, RF_Public | RF_Standalone);
+
+			// Stored as an imported WAV, the same as a sound wave made by the importer
+			TArray<uint8> WaveFile;
+			SerializeWaveFile(WaveFile, reinterpret_cast<const uint8*>(RenderedPCM.GetData()), RenderedPCM.Num() * sizeof(int16), NumOutputChannels, SampleRate);
+			RenderedWave->RawData.UpdatePayload(FSharedBuffer::Clone(WaveFile.GetData(), WaveFile.Num()));
+
+			RenderedWave->NumChannels = NumOutputChannels;
+			RenderedWave->SetSampleRate(SampleRate);
+			RenderedWave->Duration = (float)NumFrames / SampleRate;
+			RenderedWave->InvalidateCompressedData(true, false);
+			RenderedWave->PostEditChange();
+
+			FAssetRegistryModule::AssetCreated(RenderedWave);
+			Package->MarkPackageDirty();
+
+			const FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			if (!UPackage::SavePackage(Package, RenderedWave, *PackageFilename, SaveArgs))
+			{
+				UE_LOG(LogDattorroReverbRender, Warning, TEXT("Could not save %s - the sound wave is left unsaved in the editor"), *PackageFilename);
+			}
+
+			OnRendered.ExecuteIfBound(RenderedWave);
+		});
+	});
+#else
+	UE_LOG(LogDattorroReverbRender, Warning, TEXT("Sound waves can only be rendered to new assets in the editor - use Render Dattorro Reverb (PCM)"));
+	OnRendered.ExecuteIfBound(nullptr);
+#endif
+}
@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DattorroSampleConversion.h"
+#include "Math/VectorRegister.h"
+
+namespace Audio
+{
+	void ArrayFloatToHalf(TArrayView<const float> InValues, TArrayView<uint16> OutValues)
+	{
+		check(InValues.Num() == OutValues.Num());
+
+		const float* Src = InValues.GetData();
+		uint16* Dst = OutValues.GetData();
+		const int32 Num = InValues.Num();
+		const int32 NumToSimd = Num & ~3;
+
+		// FPlatformMath picks F16C (vcvtps2ph) or NEON (vcvt_f16_f32) when available
+		for (int32 Index = 0; Index < NumToSimd; Index += 4)
+		{
+			FPlatformMath::VectorStoreHalf(&Dst[Index], &Src[Index]);
+		}
+		for (int32 Index = NumToSimd; Index < Num; ++Index)
+		{
+			FPlatformMath::StoreHalf(&Dst[Index], Src[Index]);
+		}
+	}
+
+	void ArrayFloatToScaledInt16(TArrayView<const float> InValues, float InScale, TArrayView<int16> OutValues)
+	{
+		check(InValues.Num() == OutValues.Num());
+
+		const float* Src = InValues.GetData();
+		int16* Dst = OutValues.GetData();
+		const int32 Num = InValues.Num();
+		int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		const float32x4_t Scale = vdupq_n_f32(InScale);
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			// Round to nearest, then narrow with saturation
+			const int32x4_t Whole = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(&Src[Index]), Scale));
+			vst1_s16(&Dst[Index], vqmovn_s32(Whole));
+		}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+		const __m128 Scale = _mm_set1_ps(InScale);
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			// Round to nearest, then pack with saturation
+			const __m128i Whole = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&Src[Index]), Scale));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Dst[Index]), _mm_packs_epi32(Whole, Whole));
+		}
+#endif
+
+		for (; Index < Num; ++Index)
+		{
+			Dst[Index] = (int16)FMath::Clamp(FMath::RoundToInt(Src[Index] * InScale), -32768, 32767);
+		}
+	}
+}
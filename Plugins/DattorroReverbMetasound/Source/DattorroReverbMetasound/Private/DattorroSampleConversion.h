@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Audio
+{
+	// Converts floats to IEEE half precision. Uses F16C / NEON conversion four samples at a time where the platform has it.
+	void ArrayFloatToHalf(TArrayView<const float> InValues, TArrayView<uint16> OutValues);
+
+	// Multiplies by InScale and converts to int16 with saturation.
+	void ArrayFloatToScaledInt16(TArrayView<const float> InValues, float InScale, TArrayView<int16> OutValues);
+}
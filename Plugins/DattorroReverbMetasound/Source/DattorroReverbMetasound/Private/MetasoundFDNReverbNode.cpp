@@ -0,0 +1,480 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Internationalization/Text.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundFacade.h"
+#include "DSP/FloatArrayMath.h"
+#include "Math/VectorRegister.h"
+#include "DattorroDelayPool.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodesFDNReverberation"
+
+namespace Metasound
+{
+	namespace FDNReverberate
+	{
+		// METASOUND_PARAM: Variable Name - Node Name - Node Description.
+		// -------------------- Input --------------------
+		METASOUND_PARAM(InParamAudioInput, "In", "Incoming Audio Signal")
+		METASOUND_PARAM(InParamDecayTime, "Decay Time", "Time in seconds for the tail to fall by 60 dB (RT60).") // clamp between 0.1 and 30
+		METASOUND_PARAM(InParamDamping, "Damping", "How much faster high frequencies decay than low ones. 0 is no absorption.") // clamp between 0 and 0.99
+		METASOUND_PARAM(InParamRoomSize, "Room Size", "Scales every delay line. 1 is a medium hall.") // clamp between 0.25 and 2
+		METASOUND_PARAM(InParamWetValue, "Wet Value", "How strong the reverberated sound is") // clamp between 0 and 1
+		METASOUND_PARAM(InParamDryValue, "Dry Value", "How strong the base sound is") // clamp between 0 and 1
+
+		// -------------------- Outputs --------------------
+		METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
+
+		static constexpr float MinDecayTime = 0.1f;
+		static constexpr float MaxDecayTime = 30.0f;
+		static constexpr float MaxDamping = 0.99f;
+		static constexpr float MinRoomSize = 0.25f;
+		static constexpr float MaxRoomSize = 2.0f;
+
+		// Peak level below which a block counts as silent (roughly -100 dBFS).
+		static constexpr float SilenceThreshold = 1.0e-5f;
+
+		// Mutually prime line lengths in samples at 48 kHz (about 21 to 62 ms). The 8 line network uses every other one.
+		static constexpr int32 BaseLineLengths[16] = { 1009, 1151, 1277, 1399, 1523, 1657, 1787, 1913, 2039, 2179, 2311, 2447, 2593, 2729, 2861, 2999 };
+		static constexpr float BaseLineSampleRate = 48000.0f;
+	}
+
+	/// Summary
+	///
+	/// Feedback delay network late reverb with NumLines delay lines (8 or 16).
+	/// The line outputs pass through a per line one-pole absorption filter, with gains set so every line loses 60 dB in the decay time,
+	/// and are then mixed by a normalised Walsh-Hadamard matrix before being fed back.
+	/// The lines sit side by side in one pooled block and are processed four to a vector register:
+	/// the Hadamard transform is log2(NumLines) butterfly stages of vector adds and subtracts, with no matrix multiply.
+	///
+	/// Summary
+	template<int32 NumLines>
+	class TFDNReverbOperator : public TExecutableOperator<TFDNReverbOperator<NumLines>>
+	{
+		static_assert(NumLines == 8 || NumLines == 16, "The FDN supports 8 or 16 lines");
+		static constexpr int32 NumRegisters = NumLines / 4;
+
+	public:
+
+		// Returns metadata such as node name, type, etc
+		static const FNodeClassMetadata& GetNodeInfo();
+		// Returns the interface for the input and output vertex (connection points for data flow)
+		static const FVertexInterface& GetVertexInterface();
+		// Creates and returns a new instance of the operator, initializing it with the provided parameters.
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		TFDNReverbOperator(const FOperatorSettings& InSettings,
+			const FAudioBufferReadRef& InAudioInput,
+			const FFloatReadRef& InDecayTime,
+			const FFloatReadRef& InDamping,
+			const FFloatReadRef& InRoomSize,
+			const FFloatReadRef& InWetValue,
+			const FFloatReadRef& InDryValue);
+
+		virtual ~TFDNReverbOperator();
+
+		// Returns the inputs for the operator (usually audio data or control parameters).
+		virtual FDataReferenceCollection GetInputs() const override;
+
+		// Returns the outputs of the operator (usually processed audio data).
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		// Executes the FDN reverberation
+		void Execute();
+
+	private:
+		// Recomputes line lengths, RT60 gains and absorption when the inputs change.
+		void UpdateLineParameters();
+
+		// In place normalised Walsh-Hadamard transform over all lines.
+		void HadamardMix(VectorRegister4Float* InOutLines) const;
+
+		bool AcquireLines();
+		void ReleaseLines();
+
+		// -------------------- Inputs --------------------
+		FAudioBufferReadRef AudioInput;
+		FFloatReadRef DecayTime;
+		FFloatReadRef Damping;
+		FFloatReadRef RoomSize;
+		FFloatReadRef WetValue;
+		FFloatReadRef DryValue;
+
+		// -------------------- Outputs --------------------
+		FAudioBufferWriteRef AudioOutput;
+
+		float SampleRate = 0.0f;
+
+		// All lines share one pooled block: line i starts at i * LineCapacity. LineCapacity is a power of two so wrapping is a mask.
+		Audio::FDelayBlock LineBlock;
+		float* LineMemory = nullptr;
+		int32 LineCapacity = 0;
+		int32 WriteIndex = 0;
+
+		int32 LineDelays[NumLines];
+
+		// Per line loop gain folded with the absorption filter input gain: g * (1 - a)
+		alignas(16) float LineInputGains[NumLines];
+		// Per line absorption filter feedback coefficient (a)
+		alignas(16) float LineAbsorption[NumLines];
+		// Absorption filter state, one per line
+		alignas(16) float LineFilterState[NumLines];
+		// Signs used to spread the input over the lines and to sum them to the output
+		alignas(16) float LineSigns[NumLines];
+
+		float PreviousDecayTime{ -1.f };
+		float PreviousDamping{ -1.f };
+		float PreviousRoomSize{ -1.f };
+
+		// Delay memory is only held from the first non-silent input until the tail has decayed.
+		int32 QuietFrameCount = 0;
+	};
+
+	template<int32 NumLines>
+	TFDNReverbOperator<NumLines>::TFDNReverbOperator(const FOperatorSettings& InSettings,
+		const FAudioBufferReadRef& InAudioInput,
+		const FFloatReadRef& InDecayTime,
+		const FFloatReadRef& InDamping,
+		const FFloatReadRef& InRoomSize,
+		const FFloatReadRef& InWetValue,
+		const FFloatReadRef& InDryValue)
+
+		: AudioInput(InAudioInput)
+		, DecayTime(InDecayTime)
+		, Damping(InDamping)
+		, RoomSize(InRoomSize)
+		, WetValue(InWetValue)
+		, DryValue(InDryValue)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, SampleRate(InSettings.GetSampleRate())
+	{
+		// Size every line for the largest room so Room Size can change without reallocating
+		const float MaxLineLength = FDNReverberate::BaseLineLengths[15] * FDNReverberate::MaxRoomSize * (SampleRate / FDNReverberate::BaseLineSampleRate);
+		LineCapacity = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::CeilToInt(MaxLineLength) + 1);
+
+		for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+		{
+			LineSigns[LineIndex] = (LineIndex & 1) ? -1.0f : 1.0f;
+			LineFilterState[LineIndex] = 0.0f;
+		}
+
+		UpdateLineParameters();
+	}
+
+	template<int32 NumLines>
+	TFDNReverbOperator<NumLines>::~TFDNReverbOperator()
+	{
+		ReleaseLines();
+	}
+
+	template<int32 NumLines>
+	FDataReferenceCollection TFDNReverbOperator<NumLines>::GetInputs() const
+	{
+		using namespace FDNReverberate;
+
+		FDataReferenceCollection InputDataReferences;
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayTime), FFloatReadRef(DecayTime));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDamping), FFloatReadRef(Damping));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamRoomSize), FFloatReadRef(RoomSize));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamWetValue), FFloatReadRef(WetValue));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDryValue), FFloatReadRef(DryValue));
+
+		return InputDataReferences;
+	}
+
+	template<int32 NumLines>
+	FDataReferenceCollection TFDNReverbOperator<NumLines>::GetOutputs() const
+	{
+		using namespace FDNReverberate;
+
+		FDataReferenceCollection OutputDataReferences;
+		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+		return OutputDataReferences;
+	}
+
+	template<int32 NumLines>
+	void TFDNReverbOperator<NumLines>::UpdateLineParameters()
+	{
+		using namespace FDNReverberate;
+
+		const float CurrentDecayTime = FMath::Clamp(*DecayTime, MinDecayTime, MaxDecayTime);
+		const float CurrentDamping = FMath::Clamp(*Damping, 0.0f, MaxDamping);
+		const float CurrentRoomSize = FMath::Clamp(*RoomSize, MinRoomSize, MaxRoomSize);
+
+		if (FMath::IsNearlyEqual(CurrentDecayTime, PreviousDecayTime)
+			&& FMath::IsNearlyEqual(CurrentDamping, PreviousDamping)
+			&& FMath::IsNearlyEqual(CurrentRoomSize, PreviousRoomSize))
+		{
+			return;
+		}
+
+		const float LengthScale = CurrentRoomSize * (SampleRate / BaseLineSampleRate);
+		const int32 LineStride = 16 / NumLines;
+
+		for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+		{
+			LineDelays[LineIndex] = FMath::Clamp(FMath::RoundToInt(BaseLineLengths[LineIndex * LineStride] * LengthScale), 1, LineCapacity - 1);
+
+			// RT60: the loop gain for a line of D samples is 10^(-3 D / (T60 * fs))
+			const float LoopGain = FMath::Pow(10.0f, -3.0f * LineDelays[LineIndex] / (CurrentDecayTime * SampleRate));
+
+			// Longer lines get proportionally more absorption, keeping the high frequency decay consistent across lines
+			const float Absorption = 1.0f - FMath::Pow(1.0f - CurrentDamping, LineDelays[LineIndex] / (float)BaseLineLengths[0]);
+			LineAbsorption[LineIndex] = FMath::Clamp(Absorption, 0.0f, MaxDamping);
+			LineInputGains[LineIndex] = LoopGain * (1.0f - LineAbsorption[LineIndex]);
+		}
+
+		PreviousDecayTime = CurrentDecayTime;
+		PreviousDamping = CurrentDamping;
+		PreviousRoomSize = CurrentRoomSize;
+	}
+
+	template<int32 NumLines>
+	void TFDNReverbOperator<NumLines>::HadamardMix(VectorRegister4Float* InOutLines) const
+	{
+		// Butterflies between registers (strides of 8 and 4 lines) are plain vector adds and subtracts
+		for (int32 Half = NumRegisters / 2; Half >= 1; Half /= 2)
+		{
+			for (int32 Start = 0; Start < NumRegisters; Start += 2 * Half)
+			{
+				for (int32 Index = Start; Index < Start + Half; ++Index)
+				{
+					const VectorRegister4Float A = InOutLines[Index];
+					const VectorRegister4Float B = InOutLines[Index + Half];
+					InOutLines[Index] = VectorAdd(A, B);
+					InOutLines[Index + Half] = VectorSubtract(A, B);
+				}
+			}
+		}
+
+		// Butterflies inside each register (strides of 2 and 1): add the swapped lanes, with the sign flipped on the lower lane of each pair
+		const VectorRegister4Float SignsStride2 = MakeVectorRegisterFloat(1.0f, 1.0f, -1.0f, -1.0f);
+		const VectorRegister4Float SignsStride1 = MakeVectorRegisterFloat(1.0f, -1.0f, 1.0f, -1.0f);
+		const VectorRegister4Float Normalise = VectorSetFloat1(1.0f / FMath::Sqrt((float)NumLines));
+
+		for (int32 Index = 0; Index < NumRegisters; ++Index)
+		{
+			VectorRegister4Float Lines = InOutLines[Index];
+			Lines = VectorMultiplyAdd(Lines, SignsStride2, VectorSwizzle(Lines, 2, 3, 0, 1));
+			Lines = VectorMultiplyAdd(Lines, SignsStride1, VectorSwizzle(Lines, 1, 0, 3, 2));
+			InOutLines[Index] = VectorMultiply(Lines, Normalise);
+		}
+	}
+
+	template<int32 NumLines>
+	bool TFDNReverbOperator<NumLines>::AcquireLines()
+	{
+		LineBlock = Audio::FDelayBlockPool::Get().Acquire(NumLines * LineCapacity * sizeof(float));
+		LineMemory = static_cast<float*>(LineBlock.Data);
+		WriteIndex = 0;
+		QuietFrameCount = 0;
+
+		for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+		{
+			LineFilterState[LineIndex] = 0.0f;
+		}
+
+		return LineMemory != nullptr;
+	}
+
+	template<int32 NumLines>
+	void TFDNReverbOperator<NumLines>::ReleaseLines()
+	{
+		Audio::FDelayBlockPool::Get().Release(LineBlock);
+		LineMemory = nullptr;
+	}
+
+	template<int32 NumLines>
+	void TFDNReverbOperator<NumLines>::Execute()
+	{
+		using namespace FDNReverberate;
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(TFDNReverbOperator::Execute);
+
+		const float* InputAudio = AudioInput->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumFrames = AudioInput->Num();
+
+		// ------------------------------- Lazy Delay Memory -------------------------------
+
+		const bool bInputIsSilent = Audio::ArrayMaxAbsValue(TArrayView<const float>(InputAudio, NumFrames)) <= SilenceThreshold;
+		if (LineMemory == nullptr && (bInputIsSilent || !AcquireLines()))
+		{
+			// No tail in flight and nothing coming in - only the dry signal remains.
+			Audio::ArrayMultiplyByConstant(TArrayView<const float>(InputAudio, NumFrames), *DryValue, TArrayView<float>(OutputAudio, NumFrames));
+			return;
+		}
+
+		UpdateLineParameters();
+
+		const float Wet = *WetValue / FMath::Sqrt((float)NumLines);
+		const float Dry = *DryValue;
+		const int32 WrapMask = LineCapacity - 1;
+
+		VectorRegister4Float InputGains[NumRegisters];
+		VectorRegister4Float Absorption[NumRegisters];
+		VectorRegister4Float FilterState[NumRegisters];
+		VectorRegister4Float Signs[NumRegisters];
+		for (int32 Index = 0; Index < NumRegisters; ++Index)
+		{
+			InputGains[Index] = VectorLoadAligned(&LineInputGains[Index * 4]);
+			Absorption[Index] = VectorLoadAligned(&LineAbsorption[Index * 4]);
+			FilterState[Index] = VectorLoadAligned(&LineFilterState[Index * 4]);
+			Signs[Index] = VectorLoadAligned(&LineSigns[Index * 4]);
+		}
+
+		alignas(16) float LineOutputs[NumLines];
+		alignas(16) float LineWrites[NumLines];
+
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			// Gather the delayed sample from every line
+			for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+			{
+				LineOutputs[LineIndex] = LineMemory[LineIndex * LineCapacity + ((WriteIndex - LineDelays[LineIndex]) & WrapMask)];
+			}
+
+			// Absorption: s = a * s + g * (1 - a) * y, four lines at a time. Summing to the output uses alternating signs to decorrelate.
+			VectorRegister4Float Mixed[NumRegisters];
+			VectorRegister4Float OutputSum = VectorZeroFloat();
+			for (int32 Index = 0; Index < NumRegisters; ++Index)
+			{
+				const VectorRegister4Float Delayed = VectorLoadAligned(&LineOutputs[Index * 4]);
+				FilterState[Index] = VectorMultiplyAdd(FilterState[Index], Absorption[Index], VectorMultiply(Delayed, InputGains[Index]));
+				Mixed[Index] = FilterState[Index];
+				OutputSum = VectorMultiplyAdd(FilterState[Index], Signs[Index], OutputSum);
+			}
+
+			// Mix the lines back into each other and add the input, spread over the lines with the same signs
+			HadamardMix(Mixed);
+			const VectorRegister4Float Input = VectorSetFloat1(InputAudio[FrameIndex]);
+			for (int32 Index = 0; Index < NumRegisters; ++Index)
+			{
+				VectorStoreAligned(VectorMultiplyAdd(Input, Signs[Index], Mixed[Index]), &LineWrites[Index * 4]);
+			}
+
+			for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+			{
+				LineMemory[LineIndex * LineCapacity + WriteIndex] = LineWrites[LineIndex];
+			}
+			WriteIndex = (WriteIndex + 1) & WrapMask;
+
+			alignas(16) float OutputLanes[4];
+			VectorStoreAligned(OutputSum, OutputLanes);
+			const float WetSample = (OutputLanes[0] + OutputLanes[1]) + (OutputLanes[2] + OutputLanes[3]);
+
+			OutputAudio[FrameIndex] = (InputAudio[FrameIndex] * Dry) + (WetSample * Wet);
+		}
+
+		for (int32 Index = 0; Index < NumRegisters; ++Index)
+		{
+			VectorStoreAligned(FilterState[Index], &LineFilterState[Index * 4]);
+		}
+
+		// Give the lines back once both the input and the tail have been silent for longer than any line can hold a sample.
+		if (bInputIsSilent && Audio::ArrayMaxAbsValue(TArrayView<const float>(OutputAudio, NumFrames)) <= SilenceThreshold)
+		{
+			QuietFrameCount += NumFrames;
+			if (QuietFrameCount >= LineCapacity)
+			{
+				ReleaseLines();
+			}
+		}
+		else
+		{
+			QuietFrameCount = 0;
+		}
+	}
+
+	template<int32 NumLines>
+	const FVertexInterface& TFDNReverbOperator<NumLines>::GetVertexInterface()
+	{
+		using namespace FDNReverberate;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayTime), 2.5f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDamping), 0.3f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamRoomSize), 1.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamWetValue), 0.65f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDryValue), 0.35f)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	template<int32 NumLines>
+	const FNodeClassMetadata& TFDNReverbOperator<NumLines>::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.ClassName = { StandardNodes::Namespace, "FDN Reverberation", *FString::Printf(TEXT("%d Lines"), NumLines) };
+			Info.MajorVersion = 1;
+			Info.MinorVersion = 0;
+			Info.DisplayName = FText::Format(METASOUND_LOCTEXT("FDNReverbNode_DisplayName", "FDN Reverberation ({0} Lines)"), NumLines);
+			Info.Description = METASOUND_LOCTEXT("FDNReverbNode_Description", "Reverberates the Audio Input with a feedback delay network. Suited to large spaces.");
+			Info.Author = PluginAuthor;
+			Info.PromptIfMissing = PluginNodeMissingPrompt;
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Functions);
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	template<int32 NumLines>
+	TUniquePtr<IOperator> TFDNReverbOperator<NumLines>::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	{
+		using namespace FDNReverberate;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
+		FFloatReadRef DecayTime = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayTime), InParams.OperatorSettings);
+		FFloatReadRef Damping = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDamping), InParams.OperatorSettings);
+		FFloatReadRef RoomSize = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamRoomSize), InParams.OperatorSettings);
+		FFloatReadRef WetValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamWetValue), InParams.OperatorSettings);
+		FFloatReadRef DryValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDryValue), InParams.OperatorSettings);
+
+		return MakeUnique<TFDNReverbOperator<NumLines>>(InParams.OperatorSettings, AudioIn, DecayTime, Damping, RoomSize, WetValue, DryValue);
+	}
+
+	template<int32 NumLines>
+	class TFDNReverbNode : public FNodeFacade
+	{
+	public:
+		/**
+		 * Constructor used by the Metasound Frontend.
+		 */
+		TFDNReverbNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<TFDNReverbOperator<NumLines>>())
+		{
+		}
+	};
+
+	using FFDNReverbNode8 = TFDNReverbNode<8>;
+	using FFDNReverbNode16 = TFDNReverbNode<16>;
+
+	METASOUND_REGISTER_NODE(FFDNReverbNode8)
+	METASOUND_REGISTER_NODE(FFDNReverbNode16)
+}
+
+#undef LOCTEXT_NAMESPACE
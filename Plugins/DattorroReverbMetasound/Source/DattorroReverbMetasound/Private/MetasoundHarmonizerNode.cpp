@@ -0,0 +1,406 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Internationalization/Text.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundFacade.h"
+#include "DSP/Dsp.h"
+#include "Math/VectorRegister.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "DattorroPooledDelay.h"
+#include "DattorroMetasoundEnums.h"
+#include "DattorroCrossfadeGain.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodesHarmonizer"
+
+namespace Metasound
+{
+	namespace Harmonizer
+	{
+		// METASOUND_PARAM: Variable Name - Node Name - Node Description.
+		METASOUND_PARAM(InParamAudioInput, "In", "Audio input.")
+		METASOUND_PARAM(InParamPitchShifts, "Pitch Shifts", "One pitch shift per voice, in semitones (up to 8 voices). An empty array outputs silence.")
+		METASOUND_PARAM(InParamDelayLength, "Delay Length", "The delay length shared by every voice in milliseconds (10 ms to 100 ms). Changing this can reduce artifacts in certain pitch shift regions.")
+		METASOUND_PARAM(InParamDelayStorage, "Delay Storage", "Sample format of the shared delay buffer. 16-bit formats halve its memory. Read when the node is built.")
+		METASOUND_PARAM(OutParamAudio, "Out", "The voices summed, scaled by 1 / sqrt(number of voices) so the level stays roughly constant as voices are added.")
+
+		static constexpr float MinDelayLength = 10.0f;
+		static constexpr float MaxDelayLength = 100.0f;
+		static constexpr float MaxAbsPitchShiftInOctaves = 6.0f;
+
+		// Voices are processed four to a SIMD register
+		static constexpr int32 NumVoiceLanes = 4;
+		static constexpr int32 MaxVoiceGroups = 2;
+		static constexpr int32 MaxVoices = NumVoiceLanes * MaxVoiceGroups;
+	}
+
+	/// Summary
+	///
+	/// Several doppler pitch shifters reading one delay buffer - the same algorithm as FPitchShiftOperator,
+	/// but the input is written once and every voice only adds its own phasor and two taps.
+	/// Memory and write bandwidth stay those of a single pitch shifter whatever the voice count.
+	///
+	/// Voices sit in the lanes of a SIMD register (four per group), so the phasors, wraps, tap delays and crossfade gains
+	/// for four voices cost the same as for one. The taps of the whole block are laid out frame by frame, voice by voice,
+	/// and resolved by one block read of the shared buffer.
+	///
+	/// Summary
+	class FHarmonizerOperator : public TExecutableOperator<FHarmonizerOperator>
+	{
+	public:
+		using FPitchShiftArrayReadRef = TDataReadReference<TArray<float>>;
+
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		FHarmonizerOperator(const FOperatorSettings& InSettings,
+			const FAudioBufferReadRef& InAudioInput,
+			const FPitchShiftArrayReadRef& InPitchShifts,
+			const FFloatReadRef& InDelayLength,
+			const FEnumDattorroDelayStorageReadRef& InDelayStorage);
+
+		virtual FDataReferenceCollection GetInputs() const override;
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		void Execute();
+
+	private:
+		float GetDelayLengthClamped() const;
+
+		// Picks up changes to the pitch shift array, returns true if the voice count or any voice's pitch changed
+		bool UpdateVoices();
+
+		FAudioBufferReadRef AudioInput;
+		FPitchShiftArrayReadRef PitchShifts;
+		FFloatReadRef DelayLength;
+		FEnumDattorroDelayStorageReadRef DelayStorage;
+		FAudioBufferWriteRef AudioOutput;
+
+		// The shared delay buffer. Holds MaxDelayLength plus one block, as each block is written before it is read.
+		Audio::FPooledDelay DelayBuffer;
+
+		float SampleRate = 0.0f;
+
+		// The delay length, shared by every voice
+		Audio::FExponentialEase CurrentDelayLength;
+
+		int32 NumVoices = 0;
+		int32 NumVoiceGroups = 0;
+
+		// The clamped pitch shift of each voice in semitones
+		float CurrentPitchShifts[Harmonizer::MaxVoices] = {};
+
+		// Phasor increment x delay length (ms) per voice, so the increment is one multiply by 1 / length while the length eases
+		float PhaseIncrementScales[Harmonizer::MaxVoices] = {};
+
+		// Output weight per voice: 1 / sqrt(NumVoices) for active voices, 0 for the unused lanes of the last group
+		float VoiceWeights[Harmonizer::MaxVoices] = {};
+
+		// The phasor phase of each voice (goes between 0.0 and 1.0)
+		float PhasorPhases[Harmonizer::MaxVoices] = {};
+
+		// Per block scratch, NumFrames x MaxVoices, laid out frame by frame: the tap delays (in samples), gains and delayed samples
+		TArray<float> TapDelay1;
+		TArray<float> TapDelay2;
+		TArray<float> TapGain1;
+		TArray<float> TapGain2;
+		TArray<float> TapSample1;
+		TArray<float> TapSample2;
+	};
+
+	FHarmonizerOperator::FHarmonizerOperator(const FOperatorSettings& InSettings,
+		const FAudioBufferReadRef& InAudioInput,
+		const FPitchShiftArrayReadRef& InPitchShifts,
+		const FFloatReadRef& InDelayLength,
+		const FEnumDattorroDelayStorageReadRef& InDelayStorage)
+
+		: AudioInput(InAudioInput)
+		, PitchShifts(InPitchShifts)
+		, DelayLength(InDelayLength)
+		, DelayStorage(InDelayStorage)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, SampleRate(InSettings.GetSampleRate())
+	{
+		CurrentDelayLength.Init(GetDelayLengthClamped());
+		DelayBuffer.Init(SampleRate, (0.001f * Harmonizer::MaxDelayLength) + (InSettings.GetNumFramesPerBlock() / SampleRate), GetDelayStorageFormat(*DelayStorage));
+		DelayBuffer.Acquire();
+
+		// Spread the starting phases so voices at the same pitch don't crossfade in lockstep
+		for (int32 VoiceIndex = 0; VoiceIndex < Harmonizer::MaxVoices; ++VoiceIndex)
+		{
+			PhasorPhases[VoiceIndex] = (float)VoiceIndex / Harmonizer::MaxVoices;
+		}
+
+		// Any change from the zeroed state marks the voices for an update
+		NumVoices = -1;
+		UpdateVoices();
+
+		const int32 NumScratchSamples = InSettings.GetNumFramesPerBlock() * Harmonizer::MaxVoices;
+		for (TArray<float>* Scratch : { &TapDelay1, &TapDelay2, &TapGain1, &TapGain2, &TapSample1, &TapSample2 })
+		{
+			Scratch->SetNumZeroed(NumScratchSamples);
+		}
+	}
+
+	float FHarmonizerOperator::GetDelayLengthClamped() const
+	{
+		return FMath::Clamp(*DelayLength, Harmonizer::MinDelayLength, Harmonizer::MaxDelayLength);
+	}
+
+	bool FHarmonizerOperator::UpdateVoices()
+	{
+		using namespace Harmonizer;
+
+		const TArray<float>& NewPitchShifts = *PitchShifts;
+		const int32 NewNumVoices = FMath::Min(NewPitchShifts.Num(), MaxVoices);
+
+		bool bChanged = (NewNumVoices != NumVoices);
+		for (int32 VoiceIndex = 0; VoiceIndex < NewNumVoices; ++VoiceIndex)
+		{
+			const float NewPitchShift = FMath::Clamp(NewPitchShifts[VoiceIndex], -12.0f * MaxAbsPitchShiftInOctaves, 12.0f * MaxAbsPitchShiftInOctaves);
+			if (bChanged || !FMath::IsNearlyEqual(NewPitchShift, CurrentPitchShifts[VoiceIndex]))
+			{
+				CurrentPitchShifts[VoiceIndex] = NewPitchShift;
+				bChanged = true;
+			}
+		}
+
+		if (!bChanged)
+		{
+			return false;
+		}
+
+		NumVoices = NewNumVoices;
+		NumVoiceGroups = FMath::DivideAndRoundUp(NumVoices, NumVoiceLanes);
+		const float VoiceWeight = NumVoices > 0 ? 1.0f / FMath::Sqrt((float)NumVoices) : 0.0f;
+
+		for (int32 VoiceIndex = 0; VoiceIndex < MaxVoices; ++VoiceIndex)
+		{
+			if (VoiceIndex < NumVoices)
+			{
+				// Same doppler relation as FPitchShiftOperator::GetPhasorPhaseIncrement, with the division by the delay length left for later
+				const float PitchShiftRatio = Audio::GetFrequencyMultiplier(CurrentPitchShifts[VoiceIndex]);
+				PhaseIncrementScales[VoiceIndex] = (1.0f - PitchShiftRatio) * 1000.0f / SampleRate;
+				VoiceWeights[VoiceIndex] = VoiceWeight;
+			}
+			else
+			{
+				PhaseIncrementScales[VoiceIndex] = 0.0f;
+				VoiceWeights[VoiceIndex] = 0.0f;
+			}
+		}
+
+		return true;
+	}
+
+	FDataReferenceCollection FHarmonizerOperator::GetInputs() const
+	{
+		using namespace Harmonizer;
+
+		FDataReferenceCollection InputDataReferences;
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamPitchShifts), FPitchShiftArrayReadRef(PitchShifts));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayLength), FFloatReadRef(DelayLength));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayStorage), FEnumDattorroDelayStorageReadRef(DelayStorage));
+		return InputDataReferences;
+	}
+
+	FDataReferenceCollection FHarmonizerOperator::GetOutputs() const
+	{
+		using namespace Harmonizer;
+
+		FDataReferenceCollection OutputDataReferences;
+		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+		return OutputDataReferences;
+	}
+
+	void FHarmonizerOperator::Execute()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHarmonizerOperator::Execute);
+
+		using namespace Harmonizer;
+
+		const float NewDelayLengthClamped = GetDelayLengthClamped();
+		if (!FMath::IsNearlyEqual(NewDelayLengthClamped, CurrentDelayLength.PeekCurrentValue()))
+		{
+			CurrentDelayLength.SetValue(NewDelayLengthClamped);
+		}
+		UpdateVoices();
+
+		const float* InputAudio = AudioInput->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumFrames = AudioInput->Num();
+
+		// The input is written once, whatever the number of voices
+		DelayBuffer.WriteBlock(TArrayView<const float>(InputAudio, NumFrames));
+
+		if (NumVoices == 0)
+		{
+			AudioOutput->Zero();
+			return;
+		}
+
+		const float SamplesPerMsec = 0.001f * SampleRate;
+		const int32 NumLanes = NumVoiceGroups * NumVoiceLanes;
+
+		VectorRegister4Float Phases[MaxVoiceGroups];
+		VectorRegister4Float IncrementScales[MaxVoiceGroups];
+		for (int32 GroupIndex = 0; GroupIndex < NumVoiceGroups; ++GroupIndex)
+		{
+			Phases[GroupIndex] = VectorLoad(&PhasorPhases[GroupIndex * NumVoiceLanes]);
+			IncrementScales[GroupIndex] = VectorLoad(&PhaseIncrementScales[GroupIndex * NumVoiceLanes]);
+		}
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float One = VectorOneFloat();
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+		// ------------------------------- Phasors, Tap Delays And Gains -------------------------------
+
+		// Every voice shares the delay length, so one reciprocal per frame serves all of them (and only while it eases)
+		float ReciprocalDelayLength = 1.0f / CurrentDelayLength.PeekCurrentValue();
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			if (!CurrentDelayLength.IsDone())
+			{
+				CurrentDelayLength.GetNextValue();
+				ReciprocalDelayLength = 1.0f / CurrentDelayLength.PeekCurrentValue();
+			}
+
+			const VectorRegister4Float Length = VectorSetFloat1(CurrentDelayLength.PeekCurrentValue() * SamplesPerMsec);
+			const VectorRegister4Float FramesAhead = VectorSetFloat1((float)(NumFrames - FrameIndex));
+			const VectorRegister4Float Reciprocal = VectorSetFloat1(ReciprocalDelayLength);
+
+			for (int32 GroupIndex = 0; GroupIndex < NumVoiceGroups; ++GroupIndex)
+			{
+				const int32 TapIndex = FrameIndex * NumLanes + GroupIndex * NumVoiceLanes;
+				const VectorRegister4Float Phase1 = Phases[GroupIndex];
+				const VectorRegister4Float Phase2 = VectorSelect(VectorCompareGE(Phase1, Half), VectorSubtract(Phase1, Half), VectorAdd(Phase1, Half));
+
+				VectorStore(VectorMultiplyAdd(Length, Phase1, FramesAhead), &TapDelay1[TapIndex]);
+				VectorStore(VectorMultiplyAdd(Length, Phase2, FramesAhead), &TapDelay2[TapIndex]);
+				VectorStore(Audio::VectorCrossfadeGain(Phase1), &TapGain1[TapIndex]);
+				VectorStore(Audio::VectorCrossfadeGain(Phase2), &TapGain2[TapIndex]);
+
+				// Advance and wrap to between 0.0 and 1.0 (the increment is always well under one cycle)
+				VectorRegister4Float Phase = VectorMultiplyAdd(IncrementScales[GroupIndex], Reciprocal, Phase1);
+				Phase = VectorSubtract(Phase, VectorSelect(VectorCompareGE(Phase, One), One, Zero));
+				Phase = VectorAdd(Phase, VectorSelect(VectorCompareLT(Phase, Zero), One, Zero));
+				Phases[GroupIndex] = Phase;
+			}
+		}
+
+		for (int32 GroupIndex = 0; GroupIndex < NumVoiceGroups; ++GroupIndex)
+		{
+			VectorStore(Phases[GroupIndex], &PhasorPhases[GroupIndex * NumVoiceLanes]);
+		}
+
+		// ------------------------------- Read And Mix -------------------------------
+
+		// All taps of all voices in one pass over the shared buffer
+		const int32 NumTaps = NumFrames * NumLanes;
+		DelayBuffer.ReadDelaySamplesBlock(TArrayView<const float>(TapDelay1.GetData(), NumTaps), TArrayView<float>(TapSample1.GetData(), NumTaps));
+		DelayBuffer.ReadDelaySamplesBlock(TArrayView<const float>(TapDelay2.GetData(), NumTaps), TArrayView<float>(TapSample2.GetData(), NumTaps));
+
+		VectorRegister4Float Weights[MaxVoiceGroups];
+		for (int32 GroupIndex = 0; GroupIndex < NumVoiceGroups; ++GroupIndex)
+		{
+			Weights[GroupIndex] = VectorLoad(&VoiceWeights[GroupIndex * NumVoiceLanes]);
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			VectorRegister4Float Sum = VectorZeroFloat();
+			for (int32 GroupIndex = 0; GroupIndex < NumVoiceGroups; ++GroupIndex)
+			{
+				const int32 TapIndex = FrameIndex * NumLanes + GroupIndex * NumVoiceLanes;
+				VectorRegister4Float Voices = VectorMultiply(VectorLoad(&TapGain1[TapIndex]), VectorLoad(&TapSample1[TapIndex]));
+				Voices = VectorMultiplyAdd(VectorLoad(&TapGain2[TapIndex]), VectorLoad(&TapSample2[TapIndex]), Voices);
+				Sum = VectorMultiplyAdd(Weights[GroupIndex], Voices, Sum);
+			}
+
+			// Fold the four lanes into the output sample
+			alignas(16) float Lanes[NumVoiceLanes];
+			VectorStoreAligned(Sum, Lanes);
+			OutputAudio[FrameIndex] = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		}
+	}
+
+	const FVertexInterface& FHarmonizerOperator::GetVertexInterface()
+	{
+		using namespace Harmonizer;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
+				TInputDataVertex<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPitchShifts)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayLength), 30.0f),
+				TInputDataVertex<FEnumDattorroDelayStorage>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayStorage), (int32)EDattorroDelayStorage::Float32)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FHarmonizerOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.ClassName = { StandardNodes::Namespace, "Harmonizer", StandardNodes::AudioVariant };
+			Info.MajorVersion = 1;
+			Info.MinorVersion = 0;
+			Info.DisplayName = METASOUND_LOCTEXT("HarmonizerNode_DisplayName", "Harmonizer");
+			Info.Description = METASOUND_LOCTEXT("HarmonizerNode_Description", "Layers up to 8 pitch shifted copies of the audio buffer, all reading one shared delay buffer.");
+			Info.Author = PluginAuthor;
+			Info.PromptIfMissing = PluginNodeMissingPrompt;
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Delays);
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	TUniquePtr<IOperator> FHarmonizerOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	{
+		using namespace Harmonizer;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
+		FPitchShiftArrayReadRef PitchShifts = InputCollection.GetDataReadReferenceOrConstruct<TArray<float>>(METASOUND_GET_PARAM_NAME(InParamPitchShifts));
+		FFloatReadRef DelayLength = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayLength), InParams.OperatorSettings);
+		FEnumDattorroDelayStorageReadRef DelayStorage = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroDelayStorage>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayStorage), InParams.OperatorSettings);
+
+		return MakeUnique<FHarmonizerOperator>(InParams.OperatorSettings, AudioIn, PitchShifts, DelayLength, DelayStorage);
+	}
+
+	class FHarmonizerNode : public FNodeFacade
+	{
+	public:
+		/**
+		 * Constructor used by the Metasound Frontend.
+		 */
+		FHarmonizerNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FHarmonizerOperator>())
+		{
+		}
+	};
+
+	METASOUND_REGISTER_NODE(FHarmonizerNode)
+}
+
+#undef LOCTEXT_NAMESPACE
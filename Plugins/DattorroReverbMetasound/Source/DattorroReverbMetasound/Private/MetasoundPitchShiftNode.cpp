@@ -8,8 +8,15 @@
 #include "MetasoundStandardNodesNames.h"
 #include "MetasoundAudioBuffer.h"
 #include "DSP/Delay.h"
+#include "DattorroPooledDelay.h"
+#include "DattorroMetasoundEnums.h"
+#include "DattorroCrossfadeGain.h"
+#include "DattorroFastExp2.h"
+#include "DattorroPhaseVocoder.h"
+#include "Math/VectorRegister.h"
 #include "MetasoundStandardNodesCategories.h"
 #include "MetasoundFacade.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodesPitchShift"
 
@@ -21,11 +28,30 @@ namespace Metasound
 		METASOUND_PARAM(InParamAudioInput, "In", "Audio input.")
 		METASOUND_PARAM(InParamPitchShift, "Pitch Shift", "The amount to pitch shift the audio signal, in semitones.")
 		METASOUND_PARAM(InParamDelayLength, "Delay Length", "The delay length of the internal delay buffer in milliseconds (10 ms to 100 ms). Changing this can reduce artifacts in certain pitch shift regions.")
+		METASOUND_PARAM(InParamDelayStorage, "Delay Storage", "Sample format of the internal delay buffer. 16-bit formats halve its memory. Read when the node is built.")
+		METASOUND_PARAM(InParamPitchModulation, "Pitch Modulation", "Optional audio rate pitch offset in semitones, added to Pitch Shift per sample (vibrato, doppler).")
+		METASOUND_PARAM(InParamDelayModulation, "Delay Modulation", "Optional audio rate offset in milliseconds, added to the delay length per sample.")
+		METASOUND_PARAM(InParamWindowMode, "Window", "Fixed uses Delay Length. Adaptive picks the shortest delay length that suits the current pitch shift and input, up to Delay Length.")
+		METASOUND_PARAM(InParamAlgorithm, "Algorithm", "Doppler (two delay taps) or Phase Vocoder (higher quality, much higher cost). The phase vocoder ignores the delay and modulation inputs. Read when the node is built.")
 		METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
+		METASOUND_PARAM(OutParamLatency, "Latency", "The current algorithmic latency in milliseconds (half the delay length, or one FFT frame for the phase vocoder), for compensating elsewhere.")
 
 		static constexpr float MinDelayLength = 10.0f;
 		static constexpr float MaxDelayLength = 100.0f;
 		static constexpr float MaxAbsPitchShiftInOctaves = 6.0f;
+
+		// -------------------- Adaptive Window --------------------
+
+		// Shortest window the adaptive mode will use
+		static constexpr float AdaptiveMinDelayLength = 5.0f;
+		// The window spans at least this many periods of the input, so the two taps don't comb against its pitch
+		static constexpr float AdaptiveMinPeriods = 2.0f;
+		// Highest phasor (crossfade) rate allowed - faster sweeps turn into audible amplitude modulation
+		static constexpr float AdaptiveMaxPhasorFrequency = 50.0f;
+		// Adaptive windows are rounded to this step (ms), so small changes in the estimate don't retrigger the ease
+		static constexpr float AdaptiveWindowStep = 0.5f;
+		// One pole smoothing of the period estimate, per block
+		static constexpr float PeriodSmoothing = 0.25f;
 	}
 
 	// Actual Class with all functions / variables etc.
@@ -45,7 +71,13 @@ namespace Metasound
 		FPitchShiftOperator(const FOperatorSettings& InSettings, 
 			const FAudioBufferReadRef& InAudioInput, 
 			const FFloatReadRef& InPitchShift,
-			const FFloatReadRef& InDelayLength);
+			const FFloatReadRef& InDelayLength,
+			const FEnumDattorroDelayStorageReadRef& InDelayStorage,
+			const FEnumDattorroPitchShiftWindowReadRef& InWindowMode,
+			const FAudioBufferReadRef& InPitchModulation,
+			const FAudioBufferReadRef& InDelayModulation,
+			const bool bInModulated,
+			const FEnumDattorroPitchShiftAlgorithmReadRef& InAlgorithm);
 
 		// Returns the inputs for the operator (usually audio data or control parameters).
 		virtual FDataReferenceCollection GetInputs() const override;
@@ -60,6 +92,15 @@ namespace Metasound
 		float GetPitchShiftClamped() const;
 		float GetDelayLengthClamped() const;
 		float GetPhasorPhaseIncrement() const;
+
+		// The delay length to ease towards this block - the pin in fixed mode, or the adaptive window
+		float GetTargetDelayLength(const float* InputAudio, const int32 NumFrames);
+
+		// Fills the per frame delay lengths and phasor increments from the audio rate modulation inputs
+		void ComputeModulatedIncrements(const int32 NumFrames);
+
+		// Updates the running estimate of the input's period from the positive zero crossings in this block
+		void UpdatePeriodEstimate(const float* InputAudio, const int32 NumFrames);
 		
 		// The input audio buffer
 		FAudioBufferReadRef AudioInput;
@@ -70,11 +111,33 @@ namespace Metasound
 		// The user-defined delay length (in milliseconds) of the internal delay buffer
 		FFloatReadRef DelayLength;
 
+		// The sample format of the internal delay buffer
+		FEnumDattorroDelayStorageReadRef DelayStorage;
+
+		// Fixed or adaptive delay length
+		FEnumDattorroPitchShiftWindowReadRef WindowMode;
+
+		// Audio rate offsets for the pitch shift (semitones) and delay length (ms)
+		FAudioBufferReadRef PitchModulation;
+		FAudioBufferReadRef DelayModulation;
+
+		// Whether either modulation input is connected. Without them the increment only changes while the delay length eases.
+		bool bModulated = false;
+
+		// Doppler or phase vocoder
+		FEnumDattorroPitchShiftAlgorithmReadRef Algorithm;
+
+		// Only created in phase vocoder mode, in which case the delay buffer is never acquired
+		TUniquePtr<Audio::FPhaseVocoderPitchShifter> PhaseVocoder;
+
 		// The audio output
 		FAudioBufferWriteRef AudioOutput;
 
-		// The internal delay buffer
-		Audio::FDelay DelayBuffer;
+		// The current latency in milliseconds
+		FFloatWriteRef Latency;
+
+		// The internal delay buffer. Holds MaxDelayLength plus one block, as each block is written before it is read.
+		Audio::FPooledDelay DelayBuffer;
 
 		// The sample rate of the node
 		float SampleRate = 0.0f;
@@ -90,6 +153,24 @@ namespace Metasound
 
 		// The current phasor increment (a delta, plus or minus to add to the phase every frame)
 		float PhasorPhaseIncrement = 0.0f;
+
+		// Smoothed period of the input in milliseconds, from its zero crossings (0 until the first crossing)
+		float EstimatedPeriodMs = 0.0f;
+
+		// Last input sample of the previous block, so crossings on block boundaries are counted
+		float PreviousInputSample = 0.0f;
+
+		// Per block scratch for the kernel, sized once at construction:
+		// the phasor ramp, delay length and (when modulated) phasor increment per frame, then each tap's read delay (in samples), gain and delayed sample.
+		TArray<float> PhaseBlock;
+		TArray<float> DelayLengthBlock;
+		TArray<float> PhaseIncrementBlock;
+		TArray<float> TapDelay1;
+		TArray<float> TapDelay2;
+		TArray<float> TapGain1;
+		TArray<float> TapGain2;
+		TArray<float> TapSample1;
+		TArray<float> TapSample2;
 	};
 
 	/// Summary
@@ -101,19 +182,53 @@ namespace Metasound
 	FPitchShiftOperator::FPitchShiftOperator(const FOperatorSettings& InSettings,
 		const FAudioBufferReadRef& InAudioInput,
 		const FFloatReadRef& InPitchShift,
-		const FFloatReadRef& InDelayLength)
+		const FFloatReadRef& InDelayLength,
+		const FEnumDattorroDelayStorageReadRef& InDelayStorage,
+		const FEnumDattorroPitchShiftWindowReadRef& InWindowMode,
+		const FAudioBufferReadRef& InPitchModulation,
+		const FAudioBufferReadRef& InDelayModulation,
+		const bool bInModulated,
+		const FEnumDattorroPitchShiftAlgorithmReadRef& InAlgorithm)
 
 		: AudioInput(InAudioInput)
 		, PitchShift(InPitchShift)
 		, DelayLength(InDelayLength)
+		, DelayStorage(InDelayStorage)
+		, WindowMode(InWindowMode)
+		, PitchModulation(InPitchModulation)
+		, DelayModulation(InDelayModulation)
+		, bModulated(bInModulated)
+		, Algorithm(InAlgorithm)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, Latency(FFloatWriteRef::CreateNew(0.0f))
 		, SampleRate(InSettings.GetSampleRate())
 	{
 		// Initialize the delay buffer with the initial delay length 
 		CurrentDelayLength.Init(GetDelayLengthClamped());
-		DelayBuffer.Init(InSettings.GetSampleRate(), 0.001f * PitchShift::MaxDelayLength);
+		DelayBuffer.Init(SampleRate, (0.001f * PitchShift::MaxDelayLength) + (InSettings.GetNumFramesPerBlock() / SampleRate), GetDelayStorageFormat(*DelayStorage));
 		CurrentPitchShift = GetPitchShiftClamped();
 		PhasorPhaseIncrement = GetPhasorPhaseIncrement();
+		*Latency = 0.5f * CurrentDelayLength.PeekCurrentValue();
+
+		// Everything the phase vocoder needs is allocated here. If the platform has no FFT of its size, fall back to doppler.
+		if (*Algorithm == EDattorroPitchShiftAlgorithm::PhaseVocoder)
+		{
+			PhaseVocoder = MakeUnique<Audio::FPhaseVocoderPitchShifter>();
+			if (PhaseVocoder->IsValid())
+			{
+				*Latency = 1000.0f * PhaseVocoder->GetLatencySamples() / SampleRate;
+				return;
+			}
+			PhaseVocoder.Reset();
+		}
+
+		DelayBuffer.Acquire();
+
+		const int32 NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+		for (TArray<float>* Scratch : { &PhaseBlock, &DelayLengthBlock, &PhaseIncrementBlock, &TapDelay1, &TapDelay2, &TapGain1, &TapGain2, &TapSample1, &TapSample2 })
+		{
+			Scratch->SetNumZeroed(NumFramesPerBlock);
+		}
 	}
 
 	// The getter utility functions simply utilize the constants defined in the parameter section earlier.
@@ -144,6 +259,113 @@ namespace Metasound
 		const float PhasorFrequency =  (1.0f - PitchShiftRatio) / (0.001f * CurrentDelayLength.PeekCurrentValue());
 		return PhasorFrequency / SampleRate;
 	}
+
+	/// Summary
+	///
+	/// The adaptive window is the shortest delay length that still meets two limits:
+	/// it must span a couple of periods of the input (shorter windows comb against the input's own pitch),
+	/// and the phasor must not sweep faster than AdaptiveMaxPhasorFrequency (faster crossfades are heard as a tremolo).
+	/// The phasor rate is |1 - ratio| / window, so small shifts get short windows and large shifts long ones.
+	///
+	/// Summary
+	float FPitchShiftOperator::GetTargetDelayLength(const float* InputAudio, const int32 NumFrames)
+	{
+		using namespace PitchShift;
+
+		if (*WindowMode != EDattorroPitchShiftWindow::Adaptive)
+		{
+			return GetDelayLengthClamped();
+		}
+
+		UpdatePeriodEstimate(InputAudio, NumFrames);
+
+		const float PitchShiftRatio = Audio::GetFrequencyMultiplier(GetPitchShiftClamped());
+		const float SweepLimitedLength = FMath::Abs(1.0f - PitchShiftRatio) * 1000.0f / AdaptiveMaxPhasorFrequency;
+		const float PeriodLimitedLength = AdaptiveMinPeriods * EstimatedPeriodMs;
+
+		const float AdaptiveLength = AdaptiveWindowStep * FMath::CeilToFloat(FMath::Max(SweepLimitedLength, PeriodLimitedLength) / AdaptiveWindowStep);
+		return FMath::Clamp(AdaptiveLength, AdaptiveMinDelayLength, GetDelayLengthClamped());
+	}
+
+	/// Summary
+	///
+	/// With modulation the pitch ratio and delay length change every frame, so the increment can't be eased or cached.
+	/// The serial part (the delay length ease) is stepped first, then the ratios, lengths and increments are computed
+	/// four frames at a time, with the semitone to ratio conversion done by a fast exp2 rather than a pow per frame.
+	///
+	/// Summary
+	void FPitchShiftOperator::ComputeModulatedIncrements(const int32 NumFrames)
+	{
+		using namespace PitchShift;
+
+		const float* PitchModulationData = PitchModulation->GetData();
+		const float* DelayModulationData = DelayModulation->GetData();
+		const float SamplesPerMsec = 0.001f * SampleRate;
+		const float IncrementScale = 1000.0f / SampleRate;
+		const float MaxAbsPitchShift = 12.0f * MaxAbsPitchShiftInOctaves;
+
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			if (!CurrentDelayLength.IsDone())
+			{
+				CurrentDelayLength.GetNextValue();
+			}
+			DelayLengthBlock[FrameIndex] = CurrentDelayLength.PeekCurrentValue();
+		}
+
+		const VectorRegister4Float BasePitchShift = VectorSetFloat1(CurrentPitchShift);
+		const VectorRegister4Float MinPitchShift = VectorSetFloat1(-MaxAbsPitchShift);
+		const VectorRegister4Float MaxPitchShift = VectorSetFloat1(MaxAbsPitchShift);
+		const VectorRegister4Float OctavesPerSemitone = VectorSetFloat1(1.0f / 12.0f);
+		const VectorRegister4Float MinLength = VectorSetFloat1(AdaptiveMinDelayLength);
+		const VectorRegister4Float MaxLength = VectorSetFloat1(MaxDelayLength);
+		const VectorRegister4Float VectorIncrementScale = VectorSetFloat1(IncrementScale);
+		const VectorRegister4Float VectorSamplesPerMsec = VectorSetFloat1(SamplesPerMsec);
+
+		int32 FrameIndex = 0;
+		for (; FrameIndex + 4 <= NumFrames; FrameIndex += 4)
+		{
+			const VectorRegister4Float Semitones = VectorMin(VectorMax(VectorAdd(BasePitchShift, VectorLoad(&PitchModulationData[FrameIndex])), MinPitchShift), MaxPitchShift);
+			const VectorRegister4Float PitchShiftRatio = Audio::VectorFastExp2(VectorMultiply(Semitones, OctavesPerSemitone));
+			const VectorRegister4Float Length = VectorMin(VectorMax(VectorAdd(VectorLoad(&DelayLengthBlock[FrameIndex]), VectorLoad(&DelayModulationData[FrameIndex])), MinLength), MaxLength);
+
+			// Same relation as GetPhasorPhaseIncrement: (1 - ratio) / (length in seconds) / sample rate
+			const VectorRegister4Float Increment = VectorDivide(VectorMultiply(VectorSubtract(VectorOneFloat(), PitchShiftRatio), VectorIncrementScale), Length);
+			VectorStore(Increment, &PhaseIncrementBlock[FrameIndex]);
+			VectorStore(VectorMultiply(Length, VectorSamplesPerMsec), &DelayLengthBlock[FrameIndex]);
+		}
+
+		for (; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			const float Semitones = FMath::Clamp(CurrentPitchShift + PitchModulationData[FrameIndex], -MaxAbsPitchShift, MaxAbsPitchShift);
+			const float PitchShiftRatio = Audio::GetFastExp2(Semitones / 12.0f);
+			const float Length = FMath::Clamp(DelayLengthBlock[FrameIndex] + DelayModulationData[FrameIndex], AdaptiveMinDelayLength, MaxDelayLength);
+
+			PhaseIncrementBlock[FrameIndex] = (1.0f - PitchShiftRatio) * IncrementScale / Length;
+			DelayLengthBlock[FrameIndex] = Length * SamplesPerMsec;
+		}
+	}
+
+	void FPitchShiftOperator::UpdatePeriodEstimate(const float* InputAudio, const int32 NumFrames)
+	{
+		using namespace PitchShift;
+
+		int32 NumCrossings = 0;
+		float PreviousSample = PreviousInputSample;
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			NumCrossings += (PreviousSample < 0.0f) & (InputAudio[FrameIndex] >= 0.0f);
+			PreviousSample = InputAudio[FrameIndex];
+		}
+		PreviousInputSample = PreviousSample;
+
+		// No crossing means a period longer than the block (or silence) - keep the last estimate
+		if (NumCrossings > 0)
+		{
+			const float BlockPeriodMs = 1000.0f * NumFrames / (NumCrossings * SampleRate);
+			EstimatedPeriodMs = EstimatedPeriodMs > 0.0f ? EstimatedPeriodMs + PeriodSmoothing * (BlockPeriodMs - EstimatedPeriodMs) : BlockPeriodMs;
+		}
+	}
 	
 	FDataReferenceCollection FPitchShiftOperator::GetInputs() const
 	{
@@ -153,6 +375,11 @@ namespace Metasound
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamPitchShift), FFloatReadRef(PitchShift));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayLength), FFloatReadRef(DelayLength));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayStorage), FEnumDattorroDelayStorageReadRef(DelayStorage));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamWindowMode), FEnumDattorroPitchShiftWindowReadRef(WindowMode));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamPitchModulation), FAudioBufferReadRef(PitchModulation));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayModulation), FAudioBufferReadRef(DelayModulation));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAlgorithm), FEnumDattorroPitchShiftAlgorithmReadRef(Algorithm));
 
 		return InputDataReferences;
 	}
@@ -163,12 +390,32 @@ namespace Metasound
 
 		FDataReferenceCollection OutputDataReferences;
 		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamLatency), FFloatReadRef(Latency));
 		return OutputDataReferences;
 	}
 
 	void FPitchShiftOperator::Execute()
 	{
-		const float NewDelayLengthClamped = GetDelayLengthClamped();
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPitchShiftOperator::Execute);
+
+		// The const-only input audio data
+		const float* InputAudio = AudioInput->GetData();
+
+		// The writable output audio data
+		float* OutputAudio = AudioOutput->GetData();
+
+		// The number of frames we're rendering this block
+		const int32 NumFrames = AudioInput->Num();
+
+		// The phase vocoder takes the pitch once per block and handles its own buffering
+		if (PhaseVocoder.IsValid())
+		{
+			CurrentPitchShift = GetPitchShiftClamped();
+			PhaseVocoder->ProcessBlock(TArrayView<const float>(InputAudio, NumFrames), TArrayView<float>(OutputAudio, NumFrames), Audio::GetFrequencyMultiplier(CurrentPitchShift));
+			return;
+		}
+
+		const float NewDelayLengthClamped = GetTargetDelayLength(InputAudio, NumFrames);
 		bool bRecomputePhasorIncrement = (!FMath::IsNearlyEqual(NewDelayLengthClamped, CurrentDelayLength.GetNextValue()));
 
 		// Update the pitch shift data if it's changed
@@ -182,49 +429,112 @@ namespace Metasound
 			PhasorPhaseIncrement = GetPhasorPhaseIncrement();
 		}
 
-		// The const-only input audio data
-		const float* InputAudio = AudioInput->GetData();
+		// Write the whole block to the delay buffer up front, converting it to the storage format in one pass
+		DelayBuffer.WriteBlock(TArrayView<const float>(InputAudio, NumFrames));
+		const float SamplesPerMsec = 0.001f * SampleRate;
 
-		// The writable output audio data
-		float* OutputAudio = AudioOutput->GetData();
+		// ------------------------------- Phasor Ramp -------------------------------
 
-		// The number of frames we're rendering this block
-		const int32 NumFrames = AudioInput->Num();
-
-		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		// The phasor is the only serial part, so it runs first and on its own.
+		if (bModulated)
 		{
-			// Update the interpolated delay length value
-			if (!CurrentDelayLength.IsDone())
+			// The increments and delay lengths come precomputed per frame, leaving only the accumulation here
+			ComputeModulatedIncrements(NumFrames);
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
 			{
-				PhasorPhaseIncrement = GetPhasorPhaseIncrement();
-				CurrentDelayLength.GetNextValue();
+				PhaseBlock[FrameIndex] = PhasorPhase;
+
+				PhasorPhase += PhaseIncrementBlock[FrameIndex];
+				if (PhasorPhase >= 1.0f)
+				{
+					PhasorPhase -= 1.0f;
+				}
+				else if (PhasorPhase < 0.0f)
+				{
+					PhasorPhase += 1.0f;
+				}
 			}
-		
-			// Compute the two tap delay read locations, one shifted 90 degrees out of phase
-			const float PhasorPhaseOffset = FMath::Fmod(PhasorPhase + 0.5f, 1.0f);
-			const float DelayTapRead1 = CurrentDelayLength.PeekCurrentValue() * PhasorPhase;
-			const float DelayTapRead2 = CurrentDelayLength.PeekCurrentValue() * PhasorPhaseOffset;
-
-			// This produces an overlapping cosine function that avoids pops in the output
-			const float DelayTapGain1 = FMath::Cos(PI * (PhasorPhase - 0.5f));
-			const float DelayTapGain2 = FMath::Cos(PI * (PhasorPhaseOffset - 0.5f));
-			
-			// Read the delay lines at the given tap indices, apply the gains
-			const float Sample1 = DelayTapGain1 * DelayBuffer.ReadDelayAt(DelayTapRead1);
-			const float Sample2 = DelayTapGain2 * DelayBuffer.ReadDelayAt(DelayTapRead2);
-
-			// Sum the outputs into the output frame
-			const float OutputSample = Sample1 + Sample2;
-			OutputAudio[FrameIndex] = OutputSample;
-
-			// Update the phasor state
-			PhasorPhase += PhasorPhaseIncrement;
-			// Make sure we wrap to between 0.0 and 1.0 after incrementing the phase 
-			PhasorPhase = FMath::Wrap(PhasorPhase, 0.0f, 1.0f);
-
-			// Write the output to the delay buffer
-			DelayBuffer.WriteDelayAndInc(InputAudio[FrameIndex]);
 		}
+		else
+		{
+			// While the delay length eases the increment is rescaled per frame - a divide rather than recomputing the pitch ratio.
+			const float PhaseIncrementTimesLength = PhasorPhaseIncrement * CurrentDelayLength.PeekCurrentValue();
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				// Update the interpolated delay length value
+				if (!CurrentDelayLength.IsDone())
+				{
+					CurrentDelayLength.GetNextValue();
+					PhasorPhaseIncrement = PhaseIncrementTimesLength / CurrentDelayLength.PeekCurrentValue();
+				}
+
+				PhaseBlock[FrameIndex] = PhasorPhase;
+				DelayLengthBlock[FrameIndex] = CurrentDelayLength.PeekCurrentValue() * SamplesPerMsec;
+
+				// Update the phasor state, wrapping to between 0.0 and 1.0 (the increment is always well under one cycle)
+				PhasorPhase += PhasorPhaseIncrement;
+				if (PhasorPhase >= 1.0f)
+				{
+					PhasorPhase -= 1.0f;
+				}
+				else if (PhasorPhase < 0.0f)
+				{
+					PhasorPhase += 1.0f;
+				}
+			}
+		}
+
+		// ------------------------------- Tap Delays And Gains -------------------------------
+
+		// Two taps half a cycle apart, each faded by sin(pi * phase) so one is silent while the other wraps.
+		// The block is already written, so each read reaches back past the frames that come after it.
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		const VectorRegister4Float FrameOffsets = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+		int32 FrameIndex = 0;
+		for (; FrameIndex + 4 <= NumFrames; FrameIndex += 4)
+		{
+			const VectorRegister4Float Phase1 = VectorLoad(&PhaseBlock[FrameIndex]);
+			const VectorRegister4Float Phase2 = VectorSelect(VectorCompareGE(Phase1, Half), VectorSubtract(Phase1, Half), VectorAdd(Phase1, Half));
+			const VectorRegister4Float Length = VectorLoad(&DelayLengthBlock[FrameIndex]);
+			const VectorRegister4Float FramesAhead = VectorSubtract(VectorSetFloat1((float)(NumFrames - FrameIndex)), FrameOffsets);
+
+			VectorStore(VectorMultiplyAdd(Length, Phase1, FramesAhead), &TapDelay1[FrameIndex]);
+			VectorStore(VectorMultiplyAdd(Length, Phase2, FramesAhead), &TapDelay2[FrameIndex]);
+			VectorStore(Audio::VectorCrossfadeGain(Phase1), &TapGain1[FrameIndex]);
+			VectorStore(Audio::VectorCrossfadeGain(Phase2), &TapGain2[FrameIndex]);
+		}
+
+		for (; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			const float Phase1 = PhaseBlock[FrameIndex];
+			const float Phase2 = Phase1 >= 0.5f ? Phase1 - 0.5f : Phase1 + 0.5f;
+			const float FramesAhead = (float)(NumFrames - FrameIndex);
+
+			TapDelay1[FrameIndex] = DelayLengthBlock[FrameIndex] * Phase1 + FramesAhead;
+			TapDelay2[FrameIndex] = DelayLengthBlock[FrameIndex] * Phase2 + FramesAhead;
+			TapGain1[FrameIndex] = Audio::GetCrossfadeGain(Phase1);
+			TapGain2[FrameIndex] = Audio::GetCrossfadeGain(Phase2);
+		}
+
+		// ------------------------------- Read And Mix -------------------------------
+
+		DelayBuffer.ReadDelaySamplesBlock(TArrayView<const float>(TapDelay1.GetData(), NumFrames), TArrayView<float>(TapSample1.GetData(), NumFrames));
+		DelayBuffer.ReadDelaySamplesBlock(TArrayView<const float>(TapDelay2.GetData(), NumFrames), TArrayView<float>(TapSample2.GetData(), NumFrames));
+
+		FrameIndex = 0;
+		for (; FrameIndex + 4 <= NumFrames; FrameIndex += 4)
+		{
+			const VectorRegister4Float Sample1 = VectorMultiply(VectorLoad(&TapGain1[FrameIndex]), VectorLoad(&TapSample1[FrameIndex]));
+			VectorStore(VectorMultiplyAdd(VectorLoad(&TapGain2[FrameIndex]), VectorLoad(&TapSample2[FrameIndex]), Sample1), &OutputAudio[FrameIndex]);
+		}
+
+		for (; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			OutputAudio[FrameIndex] = TapGain1[FrameIndex] * TapSample1[FrameIndex] + TapGain2[FrameIndex] * TapSample2[FrameIndex];
+		}
+
+		// The taps sweep the whole window with their gains peaking half way through it
+		*Latency = NumFrames > 0 ? 0.5f * DelayLengthBlock[NumFrames - 1] / SamplesPerMsec : 0.5f * CurrentDelayLength.PeekCurrentValue();
 	}
 
 	/// Summary
@@ -243,10 +553,16 @@ namespace Metasound
 			FInputVertexInterface(
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
 				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPitchShift), 0.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayLength), 30.0f)
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayLength), 30.0f),
+				TInputDataVertex<FEnumDattorroDelayStorage>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayStorage), (int32)EDattorroDelayStorage::Float32),
+				TInputDataVertex<FEnumDattorroPitchShiftWindow>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamWindowMode), (int32)EDattorroPitchShiftWindow::Fixed),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPitchModulation)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayModulation)),
+				TInputDataVertex<FEnumDattorroPitchShiftAlgorithm>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAlgorithm), (int32)EDattorroPitchShiftAlgorithm::Doppler)
 			),
 			FOutputVertexInterface(
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio)),
+				TOutputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamLatency))
 			)
 		);
 
@@ -261,7 +577,7 @@ namespace Metasound
 			FNodeClassMetadata Info;
 			Info.ClassName = { StandardNodes::Namespace, "Pitch Shift", StandardNodes::AudioVariant };
 			Info.MajorVersion = 1;
-			Info.MinorVersion = 1;
+			Info.MinorVersion = 4;
 			Info.DisplayName = METASOUND_LOCTEXT("DelayNode_DisplayName", "Pitch Shift");
 			Info.Description = METASOUND_LOCTEXT("DelayNode_Description", "Pitch shifts the audio buffer using a doppler shift method.");
 			Info.Author = PluginAuthor;
@@ -296,8 +612,17 @@ namespace Metasound
 		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
 		FFloatReadRef PitchShift = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamPitchShift), InParams.OperatorSettings);
 		FFloatReadRef DelayLength = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayLength), InParams.OperatorSettings);
+		FEnumDattorroDelayStorageReadRef DelayStorage = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroDelayStorage>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayStorage), InParams.OperatorSettings);
+		FEnumDattorroPitchShiftWindowReadRef WindowMode = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroPitchShiftWindow>(InputInterface, METASOUND_GET_PARAM_NAME(InParamWindowMode), InParams.OperatorSettings);
+
+		// Unconnected modulation inputs read as silence; the modulated kernel only runs if one is connected
+		const bool bModulated = InputCollection.ContainsDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamPitchModulation))
+			|| InputCollection.ContainsDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamDelayModulation));
+		FAudioBufferReadRef PitchModulation = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamPitchModulation), InParams.OperatorSettings);
+		FAudioBufferReadRef DelayModulation = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamDelayModulation), InParams.OperatorSettings);
+		FEnumDattorroPitchShiftAlgorithmReadRef Algorithm = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroPitchShiftAlgorithm>(InputInterface, METASOUND_GET_PARAM_NAME(InParamAlgorithm), InParams.OperatorSettings);
 
-		return MakeUnique<FPitchShiftOperator>(InParams.OperatorSettings, AudioIn, PitchShift, DelayLength);
+		return MakeUnique<FPitchShiftOperator>(InParams.OperatorSettings, AudioIn, PitchShift, DelayLength, DelayStorage, WindowMode, PitchModulation, DelayModulation, bModulated, Algorithm);
 	}
 
 	class FPitchShiftNode : public FNodeFacade
@@ -9,6 +9,7 @@
 #include "MetasoundStandardNodesNames.h"
 #include "MetasoundDataTypeRegistrationMacro.h"
 #include "MetasoundAudioBuffer.h"
+#include "MetasoundTrigger.h"
 #include "MetasoundFacade.h"
 #include "DSP/Dsp.h"
 #include "DSP/Filter.h"
@@ -16,9 +17,23 @@
 #include "DSP/AllPassFractionalDelay.h"
 #include "DSP/DynamicDelayAPF.h"
 #include "DSP/VoiceProcessing.h"
+#include "DSP/FloatArrayMath.h"
+#include "Math/VectorRegister.h"
+#include "DattorroPooledDelay.h"
+#include "DattorroMetasoundEnums.h"
+#include "DattorroQuadratureOscillator.h"
+#include "DattorroCrossfadeGain.h"
+#include "DattorroBandDecay.h"
+#include "DattorroEarlyReflections.h"
+#include "DattorroParameterQueue.h"
+#include "DattorroOfflineRender.h"
+#include "DattorroReverbMetasoundBPLibrary.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodesReverberation"
 
+DEFINE_LOG_CATEGORY_STATIC(LogDattorroReverb, Log, All);
+
 namespace Metasound
 {
 	namespace Reverberate
@@ -26,6 +41,16 @@ namespace Metasound
 		// METASOUND_PARAM: Variable Name - Node Name - Node Description.
 		// -------------------- Input --------------------
 		METASOUND_PARAM(InParamAudioInput, "In", "Incoming Audio Signal")
+
+		// Multichannel inputs, folded into the single tank input. Channel order follows the engine's speaker order.
+		METASOUND_PARAM(InParamAudioInputLeft, "In Left", "Incoming front left audio.")
+		METASOUND_PARAM(InParamAudioInputRight, "In Right", "Incoming front right audio.")
+		METASOUND_PARAM(InParamAudioInputCenter, "In Center", "Incoming front center audio.")
+		METASOUND_PARAM(InParamAudioInputLFE, "In LFE", "Incoming low frequency effects audio. Kept out of the tank, but mixed into the dry outputs at the same gains as the centre.")
+		METASOUND_PARAM(InParamAudioInputSideLeft, "In Side Left", "Incoming side left audio.")
+		METASOUND_PARAM(InParamAudioInputSideRight, "In Side Right", "Incoming side right audio.")
+		METASOUND_PARAM(InParamAudioInputBackLeft, "In Back Left", "Incoming back left audio.")
+		METASOUND_PARAM(InParamAudioInputBackRight, "In Back Right", "Incoming back right audio.")
 		//PreDelay - 
 		METASOUND_PARAM(InParamPreDelay, "PreDelayTime", "Delay time before the reverb begins playing") // Clamped between Min and Max PreDelay
 		// Pre Low Pass Filter
@@ -56,6 +81,10 @@ namespace Metasound
 		// Delay rate - 
 		METASOUND_PARAM(InParamRandomDelay, "Random Delay", "adjusts delay rate for specific filters") // clamp between 0 - 16?
 
+		// Excursion - modulation of the first decay diffusion filters
+		METASOUND_PARAM(InParamExcursionDepth, "Excursion Depth", "How far (in samples) the first decay diffusion delays swing either side of their length. Breaks up metallic ringing at high decay.") // clamp between 0 and 32
+		METASOUND_PARAM(InParamExcursionRate, "Excursion Rate", "Speed of the excursion modulation in Hz.") // clamp between 0 and 10
+
 		METASOUND_PARAM(InParamFinalDelay_1, "Final Delay Left", "Sets delay time for the final left feedback delay") // clamp between 0 and 1
 		METASOUND_PARAM(InParamFinalDelay_2, "Final Delay Right", "Sets delay time for the final right feedback delay") // clamp between 0 and 1
 		
@@ -63,32 +92,319 @@ namespace Metasound
 		METASOUND_PARAM(InParamWetValue, "Wet Value", "How strong the reverberated sound is") // clamp between 0 and 1
 		METASOUND_PARAM(InParamDryValue, "Dry Value", "How strong the base sound is") // clamp between 0 and 1
 
+		// Delay memory
+		METASOUND_PARAM(InParamDelayStorage, "Delay Storage", "Sample format of the pre-delay and feedback delay lines. 16-bit formats halve their memory. Read when the node is built.")
+
+		// Three band decay
+		METASOUND_PARAM(InParamDecayMode, "Decay Mode", "Whether the tank decays by the Decay Rate pin or by the three band decay times below.")
+		METASOUND_PARAM(InParamDecayTimeLow, "Decay Time Low", "Three Band mode: time in seconds for the tail below Crossover Low to fall by 60 dB.") // clamp between 0.05 and 60
+		METASOUND_PARAM(InParamDecayTimeMid, "Decay Time Mid", "Three Band mode: time in seconds for the tail between the crossovers to fall by 60 dB.") // clamp between 0.05 and 60
+		METASOUND_PARAM(InParamDecayTimeHigh, "Decay Time High", "Three Band mode: time in seconds for the tail above Crossover High to fall by 60 dB.") // clamp between 0.05 and 60
+		METASOUND_PARAM(InParamCrossoverLow, "Crossover Low", "Three Band mode: frequency in Hz between the low and mid bands.") // clamp between 20 and Crossover High
+		METASOUND_PARAM(InParamCrossoverHigh, "Crossover High", "Three Band mode: frequency in Hz between the mid and high bands.") // clamp between Crossover Low and 0.45 * sample rate
+
+		// Early reflections
+		METASOUND_PARAM(InParamEarlyReflections, "Early Reflections", "Room whose early reflections are tapped from the pre-delay and added to the wet output. Read when the node is built.")
+		METASOUND_PARAM(InParamRoomSize, "Room Size", "Scales the early reflection room - 1 is the room as named.") // clamp between 0.5 and 2
+		METASOUND_PARAM(InParamEarlyReflectionsLevel, "Early Reflections Level", "Gain of the early reflections in the wet output.") // clamp between 0 and 1
+
+		// Triggers - each takes effect at its own frame within the block
+		METASOUND_PARAM(InParamReset, "Reset", "Clears the tail in place, keeping the delay memory. Instant, so it can click on a loud tail.")
+		METASOUND_PARAM(InParamFlush, "Flush", "Fades the wet output out over 20 ms, then clears the tail and hands the delay memory back - dry only until the next input.")
+		METASOUND_PARAM(InParamFreeze, "Freeze", "Holds the current tail indefinitely - the tank loses nothing and takes no new input, and the input stage stops running.")
+		METASOUND_PARAM(InParamUnfreeze, "Unfreeze", "Lets the frozen tail decay again and feeds the input back into the tank.")
+
+		// -------------------- Shimmer (Shimmer nodes only) --------------------
+		METASOUND_PARAM(InParamShimmerAmount, "Shimmer Amount", "How much of the tank feedback is replaced by its own pitch shifted past. 0 is a plain tank, 1 feeds back only the shifted signal.") // clamp between 0 and 1
+		METASOUND_PARAM(InParamShimmerPitch, "Shimmer Pitch", "Pitch shift applied on every trip round the tank, in semitones. 12 gives the classic octave up shimmer.") // clamp between -24 and 24
+
+		// Game side parameter queue
+		METASOUND_PARAM(InParamInstanceId, "Instance ID", "Parameter queue this reverb drains - game code pushes timed Wet, Dry, decay, damping, shimmer and early reflection changes to it by this ID. 0 takes none. Read when the node is built.")
+
+		// Output tap network
+		METASOUND_PARAM(InParamOutputTaps, "Output Taps", "Which points of the tank make up the wet output - the original mix or the 14 taps from the Dattorro paper. The paper taps read the tank only, so the pre-delay taps drop out of the mix.")
+
 		
 		// -------------------- Outputs --------------------
 		METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
-		
+
+		// Stereo - each side takes its taps from its own side of the tank
+		METASOUND_PARAM(OutParamAudioLeft, "Out Left", "Left audio output. Dry signal, the first pre-delay tap and the left tank delays.")
+		METASOUND_PARAM(OutParamAudioRight, "Out Right", "Right audio output. Dry signal, the second pre-delay tap and the right tank delays.")
+
+		// Quad - the fronts carry the dry signal and the early taps, the rears the final tank delays
+		METASOUND_PARAM(OutParamAudioFrontLeft, "Out Front Left", "Front left audio output. Dry signal, the first pre-delay tap and the left feedback delay.")
+		METASOUND_PARAM(OutParamAudioFrontRight, "Out Front Right", "Front right audio output. Dry signal, the second pre-delay tap and the right feedback delay.")
+		METASOUND_PARAM(OutParamAudioRearLeft, "Out Rear Left", "Rear left audio output. The left final delay of the tank.")
+		METASOUND_PARAM(OutParamAudioRearRight, "Out Rear Right", "Rear right audio output. The right final delay of the tank.")
+
+		// Peak level below which a block counts as silent (roughly -100 dBFS).
+		static constexpr float SilenceThreshold = 1.0e-5f;
+
+		static constexpr float MaxExcursionDepth = 32.0f;
+		static constexpr float MaxExcursionRate = 10.0f;
+
+		static constexpr int32 MaxInputChannels = 8;
+
+		static constexpr float MinDecayTime = 0.05f;
+		static constexpr float MaxDecayTime = 60.0f;
+		static constexpr float MinCrossover = 20.0f;
+
+		// Lengths of the second decay diffusion all passes, in samples
+		static constexpr int32 DecayDiffusion2DelayLeft = 770;
+		static constexpr int32 DecayDiffusion2DelayRight = 960;
+
+		static constexpr float MinRoomSize = 0.5f;
+		static constexpr float MaxRoomSize = 2.0f;
+
+		// The shoebox behind each early reflection preset - dimensions (m), wall reflection and tap count
+		static Audio::FEarlyReflectionRoom GetEarlyReflectionRoom(const EDattorroEarlyReflections InRoom)
+		{
+			switch (InRoom)
+			{
+			case EDattorroEarlyReflections::SmallRoom:
+				return { { 4.0f, 3.0f, 2.5f }, 0.7f, 8 };
+			case EDattorroEarlyReflections::LargeHall:
+				return { { 20.0f, 14.0f, 8.0f }, 0.8f, 24 };
+			case EDattorroEarlyReflections::Corridor:
+				return { { 30.0f, 2.5f, 3.0f }, 0.8f, 32 };
+			default:
+				return { { 8.0f, 6.0f, 3.0f }, 0.75f, 16 };
+			}
+		}
+
+		// Wet fade of the Flush trigger, in seconds
+		static constexpr float FlushFadeTime = 0.02f;
+
+		// What a trigger input does when it fires - or a queued parameter change landing
+		enum class ETriggerAction : uint8
+		{
+			Reset,
+			Flush,
+			Freeze,
+			Unfreeze,
+			SetParameter
+		};
+
+		// One trigger or queued parameter change in the current block
+		struct FTriggerEvent
+		{
+			int32 Frame;
+			ETriggerAction Action;
+
+			// SetParameter only
+			Audio::EDattorroQueuedParameter Parameter = Audio::EDattorroQueuedParameter::WetValue;
+			float Value = 0.0f;
+		};
+
+		static constexpr int32 NumQueuedParameters = (int32)Audio::EDattorroQueuedParameter::Num;
+
+		// Window of the shimmer's doppler shifter in ms - long enough that the crossfade stays below audible tremolo rates
+		static constexpr float ShimmerWindowLength = 50.0f;
+		static constexpr float MaxAbsShimmerPitch = 24.0f;
+
+		// The tank lines the paper's output taps read from
+		enum class EOutputTapLine : uint8
+		{
+			LeftDelay,
+			LeftAllPass,
+			LeftFinalDelay,
+			RightDelay,
+			RightAllPass,
+			RightFinalDelay
+		};
+
+		// One output tap - the line, and how far along it the tap sits (paper tap index / paper line length).
+		struct FOutputTap
+		{
+			EOutputTapLine Line;
+			float Position;
+		};
+
+		static constexpr int32 NumOutputTaps = 14;
+
+		// Table 2 of the paper. Each output mostly hears the opposite half of the tank, with three taps crossed in from its own half.
+		// Signs and the 0.6 gain are applied where the taps are summed in Execute().
+		static constexpr FOutputTap OutputTaps[NumOutputTaps] =
+		{
+			// yL = d[266] + d[2974] - e[1913] + f[1996] - a[1990] - b[187] - c[1066]
+			{ EOutputTapLine::RightDelay, 266.0f / 4217.0f },
+			{ EOutputTapLine::RightDelay, 2974.0f / 4217.0f },
+			{ EOutputTapLine::RightAllPass, 1913.0f / 2656.0f },
+			{ EOutputTapLine::RightFinalDelay, 1996.0f / 3163.0f },
+			{ EOutputTapLine::LeftDelay, 1990.0f / 4453.0f },
+			{ EOutputTapLine::LeftAllPass, 187.0f / 1800.0f },
+			{ EOutputTapLine::LeftFinalDelay, 1066.0f / 3720.0f },
+			// yR = a[353] + a[3627] - b[1228] + c[2673] - d[2111] - e[335] - f[121]
+			{ EOutputTapLine::LeftDelay, 353.0f / 4453.0f },
+			{ EOutputTapLine::LeftDelay, 3627.0f / 4453.0f },
+			{ EOutputTapLine::LeftAllPass, 1228.0f / 1800.0f },
+			{ EOutputTapLine::LeftFinalDelay, 2673.0f / 3720.0f },
+			{ EOutputTapLine::RightDelay, 2111.0f / 4217.0f },
+			{ EOutputTapLine::RightAllPass, 335.0f / 2656.0f },
+			{ EOutputTapLine::RightFinalDelay, 121.0f / 3163.0f }
+		};
+
+		static constexpr float OutputTapGain = 0.6f;
+
+		// Input pin names for 1, 2, 4 (quad), 6 (5.1) or 8 (7.1) channels, in channel order.
+		static TArrayView<const TCHAR* const> GetAudioInputNames(const int32 InNumInputChannels)
+		{
+			static const TCHAR* const MonoNames[] = { METASOUND_GET_PARAM_NAME(InParamAudioInput) };
+			static const TCHAR* const StereoNames[] = { METASOUND_GET_PARAM_NAME(InParamAudioInputLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputRight) };
+			static const TCHAR* const QuadNames[] = { METASOUND_GET_PARAM_NAME(InParamAudioInputLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputRight),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputSideLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputSideRight) };
+			static const TCHAR* const FivePointOneNames[] = { METASOUND_GET_PARAM_NAME(InParamAudioInputLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputRight),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputCenter), METASOUND_GET_PARAM_NAME(InParamAudioInputLFE),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputSideLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputSideRight) };
+			static const TCHAR* const SevenPointOneNames[] = { METASOUND_GET_PARAM_NAME(InParamAudioInputLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputRight),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputCenter), METASOUND_GET_PARAM_NAME(InParamAudioInputLFE),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputBackLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputBackRight),
+				METASOUND_GET_PARAM_NAME(InParamAudioInputSideLeft), METASOUND_GET_PARAM_NAME(InParamAudioInputSideRight) };
+
+			switch (InNumInputChannels)
+			{
+			case 2: return StereoNames;
+			case 4: return QuadNames;
+			case 6: return FivePointOneNames;
+			case 8: return SevenPointOneNames;
+			default: return MonoNames;
+			}
+		}
+
+		// Fold matrix into the tank - equal power across the full range channels, LFE left out. Same channel order as the names above.
+		static TArrayView<const float> GetInputFoldGains(const int32 InNumInputChannels)
+		{
+			static constexpr float MonoGains[] = { 1.0f };
+			static constexpr float StereoGains[] = { 0.70710678f, 0.70710678f };
+			static constexpr float QuadGains[] = { 0.5f, 0.5f, 0.5f, 0.5f };
+			static constexpr float FivePointOneGains[] = { 0.4472136f, 0.4472136f, 0.4472136f, 0.0f, 0.4472136f, 0.4472136f };
+			static constexpr float SevenPointOneGains[] = { 0.37796447f, 0.37796447f, 0.37796447f, 0.0f, 0.37796447f, 0.37796447f, 0.37796447f, 0.37796447f };
+
+			switch (InNumInputChannels)
+			{
+			case 2: return StereoGains;
+			case 4: return QuadGains;
+			case 6: return FivePointOneGains;
+			case 8: return SevenPointOneGains;
+			default: return MonoGains;
+			}
+		}
+
+		// Dry mix matrix - one row of input channel gains per output channel, input channels in the order above.
+		// Channels with a matching output go straight to it; centre, LFE and surrounds with none are folded into the nearest
+		// outputs at -3 dB. Mono inputs go to every front, as the single channel node always did.
+		static TArrayView<const float> GetDryMixGains(const int32 InNumInputChannels, const int32 InNumOutputChannels)
+		{
+			static constexpr float H = 0.70710678f;
+
+			// Mono out - mono as is, anything else the stereo downmix below summed at -3 dB
+			static constexpr float MonoFromMono[] = { 1.0f };
+			static constexpr float MonoFromStereo[] = { H, H };
+			static constexpr float MonoFromQuad[] = { H, H, 0.5f, 0.5f };
+			static constexpr float MonoFromFivePointOne[] = { H, H, 1.0f, 1.0f, 0.5f, 0.5f };
+			static constexpr float MonoFromSevenPointOne[] = { H, H, 1.0f, 1.0f, 0.5f, 0.5f, 0.5f, 0.5f };
+
+			// Stereo out
+			static constexpr float StereoFromMono[] = { 1.0f, 1.0f };
+			static constexpr float StereoFromStereo[] = {
+				1.0f, 0.0f,
+				0.0f, 1.0f };
+			static constexpr float StereoFromQuad[] = {
+				1.0f, 0.0f, H, 0.0f,
+				0.0f, 1.0f, 0.0f, H };
+			static constexpr float StereoFromFivePointOne[] = {
+				1.0f, 0.0f, H, H, H, 0.0f,
+				0.0f, 1.0f, H, H, 0.0f, H };
+			static constexpr float StereoFromSevenPointOne[] = {
+				1.0f, 0.0f, H, H, H, 0.0f, H, 0.0f,
+				0.0f, 1.0f, H, H, 0.0f, H, 0.0f, H };
+
+			// Quad out - front left, front right, rear left, rear right
+			static constexpr float QuadFromMono[] = { 1.0f, 1.0f, 0.0f, 0.0f };
+			static constexpr float QuadFromStereo[] = {
+				1.0f, 0.0f,
+				0.0f, 1.0f,
+				0.0f, 0.0f,
+				0.0f, 0.0f };
+			static constexpr float QuadFromQuad[] = {
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, 0.0f,
+				0.0f, 0.0f, 0.0f, 1.0f };
+			static constexpr float QuadFromFivePointOne[] = {
+				1.0f, 0.0f, H, H, 0.0f, 0.0f,
+				0.0f, 1.0f, H, H, 0.0f, 0.0f,
+				0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+				0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+			static constexpr float QuadFromSevenPointOne[] = {
+				1.0f, 0.0f, H, H, 0.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, H, H, 0.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 0.0f, 0.0f, H, 0.0f, H, 0.0f,
+				0.0f, 0.0f, 0.0f, 0.0f, 0.0f, H, 0.0f, H };
+
+			switch (InNumOutputChannels)
+			{
+			case 2:
+				switch (InNumInputChannels)
+				{
+				case 2: return StereoFromStereo;
+				case 4: return StereoFromQuad;
+				case 6: return StereoFromFivePointOne;
+				case 8: return StereoFromSevenPointOne;
+				default: return StereoFromMono;
+				}
+			case 4:
+				switch (InNumInputChannels)
+				{
+				case 2: return QuadFromStereo;
+				case 4: return QuadFromQuad;
+				case 6: return QuadFromFivePointOne;
+				case 8: return QuadFromSevenPointOne;
+				default: return QuadFromMono;
+				}
+			default:
+				switch (InNumInputChannels)
+				{
+				case 2: return MonoFromStereo;
+				case 4: return MonoFromQuad;
+				case 6: return MonoFromFivePointOne;
+				case 8: return MonoFromSevenPointOne;
+				default: return MonoFromMono;
+				}
+			}
+		}
 	}
 
 	// Actual Class with all functions / variables etc.
 	/// 
 	/// FFloatReadRef - Inputs
 	/// FFloatWriteRef - Outputs
+	///
+	/// One tank serves every output channel - the channel count only changes which taps are summed into which output,
+	/// so the stereo and quad nodes cost the same as the mono one. The node variants are the TReverberationOperator templates below.
+	/// Multichannel inputs are folded into the one tank input in the same pass as the bandwidth scaling; the dry signal keeps
+	/// the input's channels, each passed to its matching output.
 	class FReverberationOperator : public TExecutableOperator<FReverberationOperator>
 	{
 	public:
 
-		// Returns metadata such as node name, type, etc
-		static const FNodeClassMetadata& GetNodeInfo();
-		// Returns the interface for the input and output vertex (connection points for data flow)
-		static const FVertexInterface& GetVertexInterface();
-		// Creates and returns a new instance of the operator, initializing it with the provided parameters.
+		// The input pins for 1 (mono), 2 (stereo), 4 (quad), 6 (5.1) or 8 (7.1) audio channels, plus the shimmer pins if asked for
+		static FInputVertexInterface MakeInputInterface(const int32 InNumInputChannels, const bool bInWithShimmer = false);
+		// The output pins for 1 (mono), 2 (stereo) or 4 (quad) channels
+		static FOutputVertexInterface MakeOutputInterface(const int32 InNumOutputChannels);
+		// Creates and returns a new instance of the operator with the given channel counts, initializing it with the provided parameters.
 		// Also reports any errors encountered during creation.
-		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors, const int32 InNumInputChannels, const int32 InNumOutputChannels, const bool bInWithShimmer = false);
+		// Builds an operator from the render settings, reading the given input buffers.
+		static TUniquePtr<FReverberationOperator> MakeOfflineOperator(const FDattorroReverbRenderSettings& InSettings, const FOperatorSettings& InOperatorSettings, const TArray<FAudioBufferReadRef>& InAudioInputs);
+		// Builds an operator from the render settings and runs interleaved input through it, then the tail until it has died away.
+		static bool RenderOffline(const FDattorroReverbRenderSettings& InSettings, TConstArrayView<float> InInterleaved, int32 InNumInputChannels, float InSampleRate, TArray<float>& OutInterleaved);
 
 		// Constructor: Initialises the operator with settings and audio input data, including pitch shift and delay length.
 		FReverberationOperator(const FOperatorSettings& InSettings,
-			// Audio Input Buffer
-			const FAudioBufferReadRef& InAudioInput,
+			// Audio Input Buffers, one per input channel
+			const TArray<FAudioBufferReadRef>& InAudioInputs,
 			// Input Processing
 			const FFloatReadRef& InPreDelayTime,
 			const FFloatReadRef& InPreLowPassFilter,
@@ -103,14 +419,39 @@ namespace Metasound
 			const FFloatReadRef& InDecayDiffusion2,
 			const FFloatReadRef& InDecayDamping,
 			const FFloatReadRef& InParamRandomDelay,
+			const FFloatReadRef& InExcursionDepth,
+			const FFloatReadRef& InExcursionRate,
 			const FFloatReadRef& InParamFeedbackDelay_2,
 			const FFloatReadRef& InParamFinalDelay_1,
 			const FFloatReadRef& InParamFinalDelay_2,
 			const FFloatReadRef& InWetValue,
-			const FFloatReadRef& InDryValue);
+			const FFloatReadRef& InDryValue,
+			const FEnumDattorroDelayStorageReadRef& InDelayStorage,
+			const FEnumDattorroOutputTapsReadRef& InOutputTaps,
+			const FEnumDattorroDecayModeReadRef& InDecayMode,
+			const FFloatReadRef& InDecayTimeLow,
+			const FFloatReadRef& InDecayTimeMid,
+			const FFloatReadRef& InDecayTimeHigh,
+			const FFloatReadRef& InCrossoverLow,
+			const FFloatReadRef& InCrossoverHigh,
+			const FEnumDattorroEarlyReflectionsReadRef& InEarlyReflections,
+			const FFloatReadRef& InRoomSize,
+			const FFloatReadRef& InEarlyReflectionsLevel,
+			const FTriggerReadRef& InReset,
+			const FTriggerReadRef& InFlush,
+			const FTriggerReadRef& InFreeze,
+			const FTriggerReadRef& InUnfreeze,
+			const FFloatReadRef& InShimmerAmount,
+			const FFloatReadRef& InShimmerPitch,
+			const FInt32ReadRef& InInstanceId,
+			const bool bInWithShimmer = false,
+			const int32 InNumOutputChannels = 1);
 			// Audio Output Buffer
 			//const FFloatReadRef& InCutOff);
 
+		// Hands the parameter queue back, if this operator claimed one
+		virtual ~FReverberationOperator();
+
 		// Returns the inputs for the operator (usually audio data or control parameters).
 		virtual FDataReferenceCollection GetInputs() const override;
     
@@ -125,9 +466,55 @@ namespace Metasound
 
 		void InitialiseFeedbackParameters();
 
-		void WriteDelaysAndInc(float ProcessedSample, float FeedbackSampleLeft, float FeedbackSampleRight, float FinalLeft, float FinalRight);
+		void WriteDelaysAndInc(float FeedbackSampleLeft, float FeedbackSampleRight, float FinalLeft, float FinalRight);
+
+		// Reads the pre-delay at InReadMsec for a frame that is InFramesAhead frames before the end of the already written block.
+		float ReadPreDelayTap(float InReadMsec, int32 InFramesAhead) const;
+
+		// Takes zeroed delay memory from the pool on the first non-silent block.
+		bool AcquireDelays();
+
+		// Hands the delay memory back to the pool once the tail has decayed.
+		void ReleaseDelays();
+
+		// Rebuilds the paper output tap index table from the current line lengths.
+		void UpdateOutputTaps();
+
+		// Works out the three band gains for one pass through each side of the tank from the decay time pins and current line lengths.
+		void UpdateBandDecay();
+
+		// Runs the shimmer's doppler shifter over the two final delays for the whole block, ahead of the tank loop.
+		void ComputeShimmerBlock(int32 InNumFrames);
+
+		// Folds InNumFrames of the input channels from InStartFrame into ScaledAudio (the bandwidth scaled tank input) in one vectorised pass.
+		void FoldInputChannels(int32 InStartFrame, int32 InNumFrames);
+
+		// Writes InNumFrames of the dry signal from InStartFrame to every output through the dry mix matrix, scaled by InDryGain.
+		// The wet signal is added on top.
+		void MixDryChannels(int32 InStartFrame, int32 InNumFrames, float InDryGain);
+
+		// Acts on one trigger, between the frames before and after it.
+		void HandleTrigger(Reverberate::ETriggerAction InAction);
+
+		// Claims the consumer side of ParameterQueue if no other operator holds it.
+		void TryClaimParameterQueue();
+
+		// Moves this block's due parameter records into BlockEvents and carries the rest over to the next block.
+		void GatherParameterEvents(int32 InNumFrames);
+
+		// The pin behind a queued parameter.
+		const FFloatReadRef& GetParameterPin(Audio::EDattorroQueuedParameter InParameter) const;
 
-		// Executes the Reverberation operation
+		// The last queued value of a parameter, or its pin if nothing is queued over it.
+		float GetParameterValue(Audio::EDattorroQueuedParameter InParameter) const;
+
+		// Zeroes the tank in place - the delay memory if held, the feedback and filter states always.
+		void ResetTank();
+
+		// Runs the reverb over InNumFrames frames of the block from InStartFrame, with no trigger inside them.
+		void ProcessFrames(int32 InStartFrame, int32 InNumFrames);
+
+		// Executes the Reverberation operation, split at every trigger in the block
 		void Execute();
 		
 	private:
@@ -136,7 +523,9 @@ namespace Metasound
 		
 		// -------------------- Audio Input Buffer --------------------
 		
-		FAudioBufferReadRef AudioInput;
+		// One buffer per input channel, in the order of the input pins
+		TArray<FAudioBufferReadRef> AudioInputs;
+		int32 NumInputChannels = 1;
 
 		// -------------------- Input Processing --------------------
 
@@ -164,6 +553,9 @@ namespace Metasound
 
 		FFloatReadRef RandomDelay;
 
+		FFloatReadRef ExcursionDepth;
+		FFloatReadRef ExcursionRate;
+
 		FFloatReadRef InFeedbackDelay2;
 
 		FFloatReadRef InFinalDelayLeft;
@@ -172,15 +564,112 @@ namespace Metasound
 		FFloatReadRef WetValue;
 		FFloatReadRef DryValue;
 
+		FEnumDattorroDelayStorageReadRef DelayStorage;
+
+		FEnumDattorroOutputTapsReadRef OutputTapsMode;
+
+		// -------------------- Three Band Decay --------------------
+
+		FEnumDattorroDecayModeReadRef DecayMode;
+		FFloatReadRef DecayTimeLow;
+		FFloatReadRef DecayTimeMid;
+		FFloatReadRef DecayTimeHigh;
+		FFloatReadRef CrossoverLow;
+		FFloatReadRef CrossoverHigh;
+
+		// Both sides' crossovers and band gains, applied where each side writes its final delay
+		Audio::FStereoBandDecay BandDecay;
+		float PreviousCrossoverLow{ -1.f };
+		float PreviousCrossoverHigh{ -1.f };
+
+		// -------------------- Early Reflections --------------------
+
+		FEnumDattorroEarlyReflectionsReadRef EarlyReflectionsRoom;
+		FFloatReadRef RoomSize;
+		FFloatReadRef EarlyReflectionsLevel;
+
+		// Fixed when the node is built - with it off nothing below is sized or run
+		bool bEarlyReflections = false;
+		Audio::FEarlyReflections EarlyReflections;
+		float PreviousRoomSize{ -1.f };
+		float PreviousEarlyReflectionsLevel{ -1.f };
+
+		// This block's reflections for each side
+		TArray<float> EarlyLeft;
+		TArray<float> EarlyRight;
+
+		// -------------------- Triggers --------------------
+
+		FTriggerReadRef ResetTrigger;
+		FTriggerReadRef FlushTrigger;
+		FTriggerReadRef FreezeTrigger;
+		FTriggerReadRef UnfreezeTrigger;
+
+		// A flush in progress fades the wet gain down by FlushGainStep a frame, then releases the delays
+		bool bFlushing = false;
+		float FlushGain = 1.0f;
+		float FlushGainStep = 0.0f;
+
+		// While frozen the tank runs lossless on what it holds, and the input stage is skipped
+		bool bFrozen = false;
+
+		// -------------------- Shimmer --------------------
+
+		FFloatReadRef ShimmerAmount;
+		FFloatReadRef ShimmerPitch;
+
+		// Only the shimmer nodes run the shifter - the plain reverb nodes skip it entirely
+		bool bWithShimmer = false;
+
+		// Phase of the shimmer's phasor (goes between 0.0 and 1.0)
+		float ShimmerPhase = 0.0f;
+
+		// Per block shimmer scratch, only sized on shimmer nodes: the phasor ramp, the two taps' delays and gains, their samples,
+		// and the shifted signal of each final delay, ready to feed back.
+		TArray<float> ShimmerPhaseBlock;
+		TArray<float> ShimmerTapDelay1;
+		TArray<float> ShimmerTapDelay2;
+		TArray<float> ShimmerTapGain1;
+		TArray<float> ShimmerTapGain2;
+		TArray<float> ShimmerTapSample1;
+		TArray<float> ShimmerTapSample2;
+		TArray<float> ShimmerLeft;
+		TArray<float> ShimmerRight;
+
+		// -------------------- Parameter Queue --------------------
+
+		FInt32ReadRef InstanceId;
+
+		// The queue of a non-zero Instance ID. Only drained once claimed - an operator built while the one it replaces still
+		// holds the queue retries the claim every block, so it takes over as soon as the old one is destroyed.
+		TSharedPtr<Audio::FDattorroParameterQueue, ESPMode::ThreadSafe> ParameterQueue;
+		bool bParameterQueueClaimed = false;
+
+		// Records popped but not due yet, their offsets counted from the next block
+		TArray<Audio::FDattorroParameterRecord> PendingRecords;
+
+		// Queued values stand in for their pins until the pin itself moves
+		float ParameterOverrides[Reverberate::NumQueuedParameters] = {};
+		bool bParameterOverridden[Reverberate::NumQueuedParameters] = {};
+		float PreviousPinValues[Reverberate::NumQueuedParameters] = {};
+
+		// This block's triggers and parameter changes - reserved at construction, so a full queue does not allocate
+		TArray<Reverberate::FTriggerEvent> BlockEvents;
+
 		// -------------------- Audio Output Buffer --------------------
 		
-		FAudioBufferWriteRef AudioOutput;
+		// One buffer per output channel, in the order of the output pins
+		TArray<FAudioBufferWriteRef> AudioOutputs;
+		int32 NumOutputChannels = 1;
 
 		// The internal delay buffer
-		Audio::FDelay DelayBuffer;
+		Audio::FPooledDelay DelayBuffer;
 
 		// The sample rate of the node
 		float SampleRate = 0.0f;
+
+		// Longest read into the pre-delay, in samples. The buffer itself is one block longer so the whole block can be written up front.
+		float MaxPreDelaySamples = 0.0f;
 		
 		// The delay length
 		Audio::FExponentialEase CurrentDelayLength;
@@ -213,23 +702,37 @@ namespace Metasound
 
 		// Feedback Tail
 
-		TArray<Audio::FDelayAPF> DattorroAllPassFilters;
-		Audio::FDelayAPF DecayDiffusionFilter1Left;
-		Audio::FDelayAPF DecayDiffusionFilter2Left;
+		TArray<Audio::FPooledDelayAPF> DattorroAllPassFilters;
+		Audio::FPooledDelayAPF DecayDiffusionFilter1Left;
+		Audio::FPooledDelayAPF DecayDiffusionFilter2Left;
+
+		Audio::FPooledDelayAPF DecayDiffusionFilter1Right;
+		Audio::FPooledDelayAPF DecayDiffusionFilter2Right;
 
-		Audio::FDelayAPF DecayDiffusionFilter1Right;
-		Audio::FDelayAPF DecayDiffusionFilter2Right;
+		// Unmodulated lengths of the first decay diffusion filters (including the random offset), in samples
+		float DecayDiffusion1DelayLeft = 0.0f;
+		float DecayDiffusion1DelayRight = 0.0f;
+
+		// Excursion LFO - left follows the sine, right the cosine, so the two sides never swing together
+		Audio::FQuadratureOscillator ExcursionOscillator;
+		float PreviousExcursionRate{ -1.f };
+		TArray<float> ExcursionDelayLeft;
+		TArray<float> ExcursionDelayRight;
 
 		// Delay
-		Audio::FDelay PostLPFFeedbackDelayLeft;
-		Audio::FDelay PostLPFFeedbackDelayRight;
-		Audio::FDelay FeedbackDelayLeft;
+		Audio::FPooledDelay PostLPFFeedbackDelayLeft;
+		Audio::FPooledDelay PostLPFFeedbackDelayRight;
+		Audio::FPooledDelay FeedbackDelayLeft;
 		// The delay for the left side
 		Audio::FExponentialEase FeedbackDelayEaseLeft;
-		Audio::FDelay FeedbackDelayRight;
+		Audio::FPooledDelay FeedbackDelayRight;
 		// The delay for the right side
 		Audio::FExponentialEase FeedbackDelayEaseRight;		
 
+		// Paper output taps - the line each tap reads and its whole sample delay, rebuilt once per block
+		const Audio::FPooledDelay* OutputTapLines[Reverberate::NumOutputTaps] = {};
+		int32 OutputTapDelays[Reverberate::NumOutputTaps] = {};
+
 		// Variable for calculation 1 - damping value
 		float DampingMultiplicationValue;
 		
@@ -242,6 +745,20 @@ namespace Metasound
 		float FeedbackRight = NULL;
 		
 		int32 BufferIndex = 0;
+
+		// Per block scratch for the input stage, sized once at construction
+		TArray<float> ScaledAudio;
+		TArray<float> LowPassAudio;
+		TArray<float> DiffusedAudio;
+
+		// Delay memory is only held from the first non-silent input until the tail has decayed.
+		bool bDelaysAcquired = false;
+
+		// Consecutive frames of silent input and silent output while the delays are held.
+		int32 QuietFrameCount = 0;
+
+		// How long the output must stay quiet before releasing - the longest delay line, so nothing is left in flight.
+		int32 TailHoldFrames = 0;
 	};
 
 	/// Summary
@@ -251,8 +768,8 @@ namespace Metasound
 	///
 	/// Summary
 	FReverberationOperator::FReverberationOperator(const FOperatorSettings& InSettings,
-		// Audio Input Buffer
-		const FAudioBufferReadRef& InAudioInput,
+		// Audio Input Buffers
+		const TArray<FAudioBufferReadRef>& InAudioInputs,
 		// Input Processing
 		const FFloatReadRef& InPreDelayTime,
 		const FFloatReadRef& InPreLowPassFilter,
@@ -267,14 +784,37 @@ namespace Metasound
 		const FFloatReadRef& InDecayDiffusion2,
 		const FFloatReadRef& InDecayDamping,
 		const FFloatReadRef& InParamRandomDelay,
+		const FFloatReadRef& InExcursionDepth,
+		const FFloatReadRef& InExcursionRate,
 		const FFloatReadRef& InParamFeedbackDelay_2,
 		const FFloatReadRef& InParamFinalDelay_1,
 		const FFloatReadRef& InParamFinalDelay_2,
 		const FFloatReadRef& InWetValue,
-		const FFloatReadRef& InDryValue)
+		const FFloatReadRef& InDryValue,
+		const FEnumDattorroDelayStorageReadRef& InDelayStorage,
+		const FEnumDattorroOutputTapsReadRef& InOutputTaps,
+		const FEnumDattorroDecayModeReadRef& InDecayMode,
+		const FFloatReadRef& InDecayTimeLow,
+		const FFloatReadRef& InDecayTimeMid,
+		const FFloatReadRef& InDecayTimeHigh,
+		const FFloatReadRef& InCrossoverLow,
+		const FFloatReadRef& InCrossoverHigh,
+		const FEnumDattorroEarlyReflectionsReadRef& InEarlyReflections,
+		const FFloatReadRef& InRoomSize,
+		const FFloatReadRef& InEarlyReflectionsLevel,
+		const FTriggerReadRef& InReset,
+		const FTriggerReadRef& InFlush,
+		const FTriggerReadRef& InFreeze,
+		const FTriggerReadRef& InUnfreeze,
+		const FFloatReadRef& InShimmerAmount,
+		const FFloatReadRef& InShimmerPitch,
+		const FInt32ReadRef& InInstanceId,
+		const bool bInWithShimmer,
+		const int32 InNumOutputChannels)
 
 		// CHANGE THIS
-		: AudioInput(InAudioInput)
+		: AudioInputs(InAudioInputs)
+		, NumInputChannels(InAudioInputs.Num())
 		, PreDelayTime(InPreDelayTime)
 		, PreLowPassFilter(InPreLowPassFilter)
 		, LowPassCutoff(InLowPassCutoff)
@@ -287,22 +827,76 @@ namespace Metasound
 		, DecayDiffusion2(InDecayDiffusion2)
 		, DecayDamping(InDecayDamping)
 		, RandomDelay(InParamRandomDelay)
+		, ExcursionDepth(InExcursionDepth)
+		, ExcursionRate(InExcursionRate)
 		, InFeedbackDelay2(InParamFeedbackDelay_2)
 		, InFinalDelayLeft(InParamFinalDelay_1)
 		, InFinalDelayRight(InParamFinalDelay_2)
 		, WetValue(InWetValue)
 		, DryValue(InDryValue)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, DelayStorage(InDelayStorage)
+		, OutputTapsMode(InOutputTaps)
+		, DecayMode(InDecayMode)
+		, DecayTimeLow(InDecayTimeLow)
+		, DecayTimeMid(InDecayTimeMid)
+		, DecayTimeHigh(InDecayTimeHigh)
+		, CrossoverLow(InCrossoverLow)
+		, CrossoverHigh(InCrossoverHigh)
+		, EarlyReflectionsRoom(InEarlyReflections)
+		, RoomSize(InRoomSize)
+		, EarlyReflectionsLevel(InEarlyReflectionsLevel)
+		, ResetTrigger(InReset)
+		, FlushTrigger(InFlush)
+		, FreezeTrigger(InFreeze)
+		, UnfreezeTrigger(InUnfreeze)
+		, ShimmerAmount(InShimmerAmount)
+		, ShimmerPitch(InShimmerPitch)
+		, InstanceId(InInstanceId)
+		, bWithShimmer(bInWithShimmer)
+		, NumOutputChannels(InNumOutputChannels)
 		, SampleRate(InSettings.GetSampleRate())
 	{
+		for (int32 Channel = 0; Channel < NumOutputChannels; Channel++)
+		{
+			AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+		}
+
 		// Initialize the delay buffer with the initial delay length 
 		CurrentDelayLength.Init(GetDelayLengthClamped());
 
 		PhasorPhaseIncrement = GetPhasorPhaseIncrement();
 		
 		SampleRate = InSettings.GetSampleRate();
-		DelayBuffer.Init(InSettings.GetSampleRate(), (0.001f * *PreDelayTime));
+		FlushGainStep = 1.0f / (Reverberate::FlushFadeTime * SampleRate);
+		const int32 NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+		MaxPreDelaySamples = (float)(int32)(0.001f * *PreDelayTime * SampleRate);
+
+		// The early reflections tap the pre-delay too, so it must reach their furthest tap
+		bEarlyReflections = *EarlyReflectionsRoom != EDattorroEarlyReflections::Off;
+		const float PreDelayBufferTime = bEarlyReflections ? FMath::Max(0.001f * *PreDelayTime, Audio::FEarlyReflections::MaxDelayTime) : 0.001f * *PreDelayTime;
+		DelayBuffer.Init(SampleRate, PreDelayBufferTime + (NumFramesPerBlock / SampleRate), GetDelayStorageFormat(*DelayStorage));
 		DelayBuffer.SetDelaySamples(*PreDelayTime);
+
+		ScaledAudio.SetNumUninitialized(NumFramesPerBlock);
+		LowPassAudio.SetNumUninitialized(NumFramesPerBlock);
+		DiffusedAudio.SetNumUninitialized(NumFramesPerBlock);
+		ExcursionDelayLeft.SetNumUninitialized(NumFramesPerBlock);
+		ExcursionDelayRight.SetNumUninitialized(NumFramesPerBlock);
+
+		if (bEarlyReflections)
+		{
+			EarlyReflections.Init(SampleRate, NumFramesPerBlock, Reverberate::GetEarlyReflectionRoom(*EarlyReflectionsRoom).NumTaps);
+			EarlyLeft.SetNumZeroed(NumFramesPerBlock);
+			EarlyRight.SetNumZeroed(NumFramesPerBlock);
+		}
+
+		if (bWithShimmer)
+		{
+			for (TArray<float>* Scratch : { &ShimmerPhaseBlock, &ShimmerTapDelay1, &ShimmerTapDelay2, &ShimmerTapGain1, &ShimmerTapGain2, &ShimmerTapSample1, &ShimmerTapSample2, &ShimmerLeft, &ShimmerRight })
+			{
+				Scratch->SetNumZeroed(NumFramesPerBlock);
+			}
+		}
 		BufferIndex = 0; // Start buffer index at 0
 
 		LPVariableFilter.Init(SampleRate, 1);
@@ -312,7 +906,6 @@ namespace Metasound
 		DattorroAllPassFilters.SetNum(DelayLengths.Num());
 		for (int i = 0; i < DelayLengths.Num(); i++)
 		{
-			DattorroAllPassFilters[i] = Audio::FDelayAPF();
 			DattorroAllPassFilters[i].Init(SampleRate);
 		}
 
@@ -324,6 +917,27 @@ namespace Metasound
 		
 		LPDampingFilter.Init(SampleRate, 1);
 		LPDampingFilter.SetFilterType(Audio::EFilter::LowPass);
+
+		if (*InstanceId != 0)
+		{
+			// Looked up once here, as the lookup takes the table lock - claiming it later is a single atomic
+			ParameterQueue = Audio::FDattorroParameterQueues::Get().FindOrAdd(*InstanceId);
+			PendingRecords.Reserve(Audio::FDattorroParameterQueue::Capacity);
+			TryClaimParameterQueue();
+			if (!bParameterQueueClaimed)
+			{
+				UE_LOG(LogDattorroReverb, Warning, TEXT("Another reverb already drains parameter queue %d - this one follows its pins until that one is destroyed"), *InstanceId);
+			}
+		}
+		BlockEvents.Reserve(Audio::FDattorroParameterQueue::Capacity + 64);
+	}
+
+	FReverberationOperator::~FReverberationOperator()
+	{
+		if (bParameterQueueClaimed)
+		{
+			Audio::FDattorroParameterQueues::Get().ReleaseConsumer(*ParameterQueue);
+		}
 	}
 	
 	FDataReferenceCollection FReverberationOperator::GetInputs() const
@@ -331,8 +945,12 @@ namespace Metasound
 		using namespace Reverberate;
 
 		FDataReferenceCollection InputDataReferences;
-		// Audio Input Buffer
-		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
+		// Audio Input Buffers
+		const TArrayView<const TCHAR* const> AudioInputNames = GetAudioInputNames(NumInputChannels);
+		for (int32 Channel = 0; Channel < NumInputChannels; Channel++)
+		{
+			InputDataReferences.AddDataReadReference(AudioInputNames[Channel], FAudioBufferReadRef(AudioInputs[Channel]));
+		}
 		// Inputs
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamPreDelay), FFloatReadRef(PreDelayTime));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamPreLPF), FFloatReadRef(PreLowPassFilter));
@@ -347,11 +965,34 @@ namespace Metasound
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayDiffusion_2), FFloatReadRef(DecayDiffusion2));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayDamping), FFloatReadRef(DecayDamping));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamRandomDelay), FFloatReadRef(RandomDelay));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamExcursionDepth), FFloatReadRef(ExcursionDepth));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamExcursionRate), FFloatReadRef(ExcursionRate));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFeedbackDelay_2), FFloatReadRef(InFeedbackDelay2));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFinalDelay_1), FFloatReadRef(InFinalDelayLeft));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFinalDelay_2), FFloatReadRef(InFinalDelayRight));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamWetValue), FFloatReadRef(WetValue));
 		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDryValue), FFloatReadRef(DryValue));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDelayStorage), FEnumDattorroDelayStorageReadRef(DelayStorage));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamOutputTaps), FEnumDattorroOutputTapsReadRef(OutputTapsMode));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayMode), FEnumDattorroDecayModeReadRef(DecayMode));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayTimeLow), FFloatReadRef(DecayTimeLow));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayTimeMid), FFloatReadRef(DecayTimeMid));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayTimeHigh), FFloatReadRef(DecayTimeHigh));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamCrossoverLow), FFloatReadRef(CrossoverLow));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamCrossoverHigh), FFloatReadRef(CrossoverHigh));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamEarlyReflections), FEnumDattorroEarlyReflectionsReadRef(EarlyReflectionsRoom));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamRoomSize), FFloatReadRef(RoomSize));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamEarlyReflectionsLevel), FFloatReadRef(EarlyReflectionsLevel));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamReset), FTriggerReadRef(ResetTrigger));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFlush), FTriggerReadRef(FlushTrigger));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFreeze), FTriggerReadRef(FreezeTrigger));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamUnfreeze), FTriggerReadRef(UnfreezeTrigger));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamInstanceId), FInt32ReadRef(InstanceId));
+		if (bWithShimmer)
+		{
+			InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamShimmerAmount), FFloatReadRef(ShimmerAmount));
+			InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamShimmerPitch), FFloatReadRef(ShimmerPitch));
+		}
 
 		return InputDataReferences;
 	}
@@ -361,7 +1002,22 @@ namespace Metasound
 		using namespace Reverberate;
 
 		FDataReferenceCollection OutputDataReferences;
-		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+		switch (NumOutputChannels)
+		{
+		case 2:
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioLeft), FAudioBufferReadRef(AudioOutputs[0]));
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioRight), FAudioBufferReadRef(AudioOutputs[1]));
+			break;
+		case 4:
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioFrontLeft), FAudioBufferReadRef(AudioOutputs[0]));
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioFrontRight), FAudioBufferReadRef(AudioOutputs[1]));
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioRearLeft), FAudioBufferReadRef(AudioOutputs[2]));
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudioRearRight), FAudioBufferReadRef(AudioOutputs[3]));
+			break;
+		default:
+			OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutputs[0]));
+			break;
+		}
 		return OutputDataReferences;
 	}
 
@@ -443,12 +1099,13 @@ namespace Metasound
 		
 		// make custom delay variables?
 		// Left Feedback Delay
-		FeedbackDelayLeft.Init(SampleRate, 0.001f * LeftSampleDelay);
+		const Audio::EDelayStorageFormat StorageFormat = GetDelayStorageFormat(*DelayStorage);
+		FeedbackDelayLeft.Init(SampleRate, 0.001f * LeftSampleDelay, StorageFormat);
 		FeedbackDelayLeft.SetDelaySamples(LeftSampleDelay); // Feedback delay time in samples
 		FeedbackDelayEaseLeft.Init(LeftSampleDelay);
 		FeedbackDelayEaseLeft.SetValue(LeftSampleDelay);
 		// Right Feedback Delay
-		FeedbackDelayRight.Init(SampleRate, 0.001f * RightSampleDelay);
+		FeedbackDelayRight.Init(SampleRate, 0.001f * RightSampleDelay, StorageFormat);
 		FeedbackDelayRight.SetDelaySamples(RightSampleDelay); // Feedback delay time in samples
 		FeedbackDelayEaseRight.Init(RightSampleDelay);
 		FeedbackDelayEaseRight.SetValue(RightSampleDelay);
@@ -457,9 +1114,9 @@ namespace Metasound
 		const float LeftSampleFinalDelay = *InFinalDelayLeft;
 		const float RightSampleFinalDelay = *InFinalDelayRight;
 		
-		PostLPFFeedbackDelayLeft.Init(SampleRate);
+		PostLPFFeedbackDelayLeft.Init(SampleRate, 2.0f, StorageFormat);
 		PostLPFFeedbackDelayLeft.SetDelaySamples(LeftSampleFinalDelay); // second feedback delay time in samples
-		PostLPFFeedbackDelayRight.Init(SampleRate);
+		PostLPFFeedbackDelayRight.Init(SampleRate, 2.0f, StorageFormat);
 		PostLPFFeedbackDelayRight.SetDelaySamples(RightSampleFinalDelay); // second feedback delay time in samples
 		
 		
@@ -469,43 +1126,35 @@ namespace Metasound
 		DecayDiffusionFilter1Left.SetG(*DecayDiffusion1);
 		const int32 DelayRate = *RandomDelay;
 		float RandomDelayValue = FMath::RandRange(0, DelayRate);
-		DecayDiffusionFilter1Left.SetDelaySamples(250 + RandomDelayValue);
+		DecayDiffusion1DelayLeft = 250 + RandomDelayValue;
+		DecayDiffusionFilter1Left.SetDelaySamples(DecayDiffusion1DelayLeft);
 
 		DecayDiffusionFilter1Right.Init(SampleRate, 0.001f * *PreDelayTime);
 		DecayDiffusionFilter1Right.SetG(*DecayDiffusion1);
 		RandomDelayValue = FMath::RandRange(0, DelayRate);
-		DecayDiffusionFilter1Right.SetDelaySamples(440 + RandomDelayValue);
+		DecayDiffusion1DelayRight = 440 + RandomDelayValue;
+		DecayDiffusionFilter1Right.SetDelaySamples(DecayDiffusion1DelayRight);
 
 		DecayDiffusionFilter2Left.Init(SampleRate, 0.001f * *PreDelayTime);
 		DecayDiffusionFilter2Left.SetG(*DecayDiffusion1);
-		DecayDiffusionFilter2Left.SetDelaySamples(770);
+		DecayDiffusionFilter2Left.SetDelaySamples(Reverberate::DecayDiffusion2DelayLeft);
 
 		DecayDiffusionFilter2Right.Init(SampleRate, 0.001f * *PreDelayTime);
 		DecayDiffusionFilter2Right.SetG(*DecayDiffusion2);
-		DecayDiffusionFilter2Right.SetDelaySamples(960);
+		DecayDiffusionFilter2Right.SetDelaySamples(Reverberate::DecayDiffusion2DelayRight);
 	}
 
-	void FReverberationOperator::WriteDelaysAndInc(float ProcessedSample, float FirstProcessedFeedbackSampleLeft, float FirstProcessedFeedbackSampleRight, float FinalDelayPassLeft, float FinalDelayPassRight)
+	void FReverberationOperator::WriteDelaysAndInc(float FirstProcessedFeedbackSampleLeft, float FirstProcessedFeedbackSampleRight, float FinalDelayPassLeft, float FinalDelayPassRight)
 	{
 		//UE_LOG(LogTemp, Log, TEXT("ProcessedSample: %.2f, FeedbackLeft: %.2f, FeedbackRight: %.2f"), ProcessedSample, FeedbackSampleLeft, FeedbackSampleRight);
 		
-		// Write the new sample to the delay buffer (for future delay reads)
-		DelayBuffer.WriteDelayAndInc(ProcessedSample);
-
-		for (int i = 0; i < DelayLengths.Num(); i++)
-		{
-			DattorroAllPassFilters[i].WriteDelayAndInc(ProcessedSample);
-		}
+		// The pre-delay and input all pass filters are written a block at a time in Execute(), before the tank runs.
 
 		// Write each specific sample to each specific delay.
+		// The decay diffusion all passes write their own state as they process, so they are not written here.
 		FeedbackDelayLeft.WriteDelayAndInc(FirstProcessedFeedbackSampleLeft);
 		FeedbackDelayRight.WriteDelayAndInc(FirstProcessedFeedbackSampleRight);
 
-		DecayDiffusionFilter1Left.WriteDelayAndInc(FirstProcessedFeedbackSampleLeft);
-		DecayDiffusionFilter2Left.WriteDelayAndInc(FirstProcessedFeedbackSampleLeft);
-		DecayDiffusionFilter1Right.WriteDelayAndInc(FirstProcessedFeedbackSampleRight);
-		DecayDiffusionFilter2Right.WriteDelayAndInc(FirstProcessedFeedbackSampleRight);
-
 		// write to final delay
 		PostLPFFeedbackDelayLeft.WriteDelayAndInc(FinalDelayPassLeft);
 		PostLPFFeedbackDelayRight.WriteDelayAndInc(FinalDelayPassRight);
@@ -515,109 +1164,758 @@ namespace Metasound
 		FeedbackRight = FinalDelayPassLeft;
 	}
 
-	void FReverberationOperator::Execute()
+	void FReverberationOperator::UpdateOutputTaps()
 	{
-		// assign input and output audio to variables at the start.
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-		// NumFrames used for looping over each sample.
-		const int32 NumFrames = AudioInput->Num();
+		using namespace Reverberate;
 
-		DampingMultiplicationValue = (1 - *DecayDamping);
-		const float DecayRateVariable = *DecayRate;
-		const float DelayLength = *PreDelayTime;
-		
-		if (bool bDelayCheck = (!FMath::IsNearlyEqual(DelayLength, CurrentDelayLength.GetNextValue())))
+		// The paper positions are scaled onto the span each line actually recirculates over here:
+		// the whole buffer for the feedback delays, the delay length for the all pass filters and the read position for the final delays.
+		const float LeftFinalSpan = FMath::Clamp(*InFinalDelayLeft, 0, 2000) * SampleRate * 0.001f;
+		const float RightFinalSpan = FMath::Clamp(*InFinalDelayRight, 0, 2000) * SampleRate * 0.001f;
+
+		for (int32 TapIndex = 0; TapIndex < NumOutputTaps; TapIndex++)
 		{
-			//UE_LOG(LogTemp, Log, TEXT("Set Value to PreDelayTime: %.3f"), DelayLength);
-			CurrentDelayLength.SetValue(DelayLength);
+			const Audio::FPooledDelay* Line = nullptr;
+			float Span = 0.0f;
+			switch (OutputTaps[TapIndex].Line)
+			{
+			case EOutputTapLine::LeftDelay:
+				Line = &FeedbackDelayLeft;
+				Span = FeedbackDelayLeft.GetBufferLengthSamples() - 1;
+				break;
+			case EOutputTapLine::LeftAllPass:
+				Line = &DecayDiffusionFilter2Left;
+				Span = DecayDiffusionFilter2Left.GetDelayLengthSamples();
+				break;
+			case EOutputTapLine::LeftFinalDelay:
+				Line = &PostLPFFeedbackDelayLeft;
+				Span = LeftFinalSpan;
+				break;
+			case EOutputTapLine::RightDelay:
+				Line = &FeedbackDelayRight;
+				Span = FeedbackDelayRight.GetBufferLengthSamples() - 1;
+				break;
+			case EOutputTapLine::RightAllPass:
+				Line = &DecayDiffusionFilter2Right;
+				Span = DecayDiffusionFilter2Right.GetDelayLengthSamples();
+				break;
+			default:
+				Line = &PostLPFFeedbackDelayRight;
+				Span = RightFinalSpan;
+				break;
+			}
+
+			OutputTapLines[TapIndex] = Line;
+			OutputTapDelays[TapIndex] = FMath::Clamp(FMath::RoundToInt(OutputTaps[TapIndex].Position * Span), 1, FMath::Max(Line->GetBufferLengthSamples() - 1, 1));
 		}
-		
-		// apply Low Pass
-		LowPassFilter();
+	}
 
-		// Array for low pass output.
-		TArray<float> LowPassAudio;
-		LowPassAudio.SetNumUninitialized(NumFrames);
+	float FReverberationOperator::ReadPreDelayTap(float InReadMsec, int32 InFramesAhead) const
+	{
+		const float TapDelaySamples = FMath::Min(InReadMsec * SampleRate * 0.001f, MaxPreDelaySamples);
+		return DelayBuffer.ReadDelaySamples(TapDelaySamples + InFramesAhead);
+	}
 
-		TArray<float> ScaledAudio;
-		ScaledAudio.SetNumUninitialized(NumFrames);
-		
-		// Store low pass filter result.
-		for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+	bool FReverberationOperator::AcquireDelays()
+	{
+		bool bAcquired = DelayBuffer.Acquire();
+		for (Audio::FPooledDelayAPF& AllPass : DattorroAllPassFilters)
 		{
-			// multiply by bandwidth value
-			ScaledAudio[FrameIndex] = InputAudio[FrameIndex] * *PreLowPassFilter;
+			bAcquired &= AllPass.Acquire();
+		}
+		bAcquired &= DecayDiffusionFilter1Left.Acquire();
+		bAcquired &= DecayDiffusionFilter2Left.Acquire();
+		bAcquired &= DecayDiffusionFilter1Right.Acquire();
+		bAcquired &= DecayDiffusionFilter2Right.Acquire();
+		bAcquired &= FeedbackDelayLeft.Acquire();
+		bAcquired &= FeedbackDelayRight.Acquire();
+		bAcquired &= PostLPFFeedbackDelayLeft.Acquire();
+		bAcquired &= PostLPFFeedbackDelayRight.Acquire();
+
+		if (!bAcquired)
+		{
+			// Stay dry rather than run a tank with missing lines.
+			ReleaseDelays();
+			return false;
 		}
-		LPVariableFilter.ProcessAudio(ScaledAudio.GetData(), NumFrames, LowPassAudio.GetData());
 
-		// Setup All Pass
-		AllPassFilter();
+		// The pool hands out zeroed memory, so clear the rest of the tank state to match.
+		FeedbackLeft = NULL;
+		FeedbackRight = NULL;
+		LPVariableFilter.Reset();
+		LPDampingFilter.Reset();
 
-		// used to change the phase increment on pitch shift - not used fully.
-		const float NewDelayLengthClamped = GetDelayLengthClamped();
-		bool bRecomputePhasorIncrement = (!FMath::IsNearlyEqual(NewDelayLengthClamped, CurrentDelayLength.GetNextValue()));
-		if (bRecomputePhasorIncrement)
+		TailHoldFrames = FMath::Max(DelayBuffer.GetBufferLengthSamples(), FeedbackDelayLeft.GetBufferLengthSamples());
+		TailHoldFrames = FMath::Max(TailHoldFrames, FeedbackDelayRight.GetBufferLengthSamples());
+		TailHoldFrames = FMath::Max(TailHoldFrames, PostLPFFeedbackDelayLeft.GetBufferLengthSamples());
+		TailHoldFrames = FMath::Max(TailHoldFrames, PostLPFFeedbackDelayRight.GetBufferLengthSamples());
+		QuietFrameCount = 0;
+
+		bDelaysAcquired = true;
+		return true;
+	}
+
+	void FReverberationOperator::ReleaseDelays()
+	{
+		DelayBuffer.Release();
+		for (Audio::FPooledDelayAPF& AllPass : DattorroAllPassFilters)
 		{
-			//UE_LOG(LogTemp, Log, TEXT("Set Value to PreDelayTime: %.3f"), CurrentDelayLength.PeekCurrentValue());
-			PhasorPhaseIncrement = GetPhasorPhaseIncrement(); 
+			AllPass.Release();
 		}
-		
-		// mix original and low pass
-		for (int32 FrameCount = 0; FrameCount < NumFrames; FrameCount++)
+		DecayDiffusionFilter1Left.Release();
+		DecayDiffusionFilter2Left.Release();
+		DecayDiffusionFilter1Right.Release();
+		DecayDiffusionFilter2Right.Release();
+		FeedbackDelayLeft.Release();
+		FeedbackDelayRight.Release();
+		PostLPFFeedbackDelayLeft.Release();
+		PostLPFFeedbackDelayRight.Release();
+		BandDecay.Reset();
+
+		bDelaysAcquired = false;
+	}
+
+	/// Summary
+	///
+	/// Three band decay - RT60 is the time to fall by 60 dB, so a pass of N samples through one side of the tank
+	/// needs a gain of 10^(-3 N / (RT60 * SampleRate)). Each side's pass is its two decay diffusion all passes,
+	/// its feedback delay and its final delay, at their current lengths, all converted to samples.
+	///
+	/// Summary
+	void FReverberationOperator::UpdateBandDecay()
+	{
+		using namespace Reverberate;
+
+		const float CurrentCrossoverHigh = FMath::Clamp(*CrossoverHigh, MinCrossover, 0.45f * SampleRate);
+		const float CurrentCrossoverLow = FMath::Clamp(*CrossoverLow, MinCrossover, CurrentCrossoverHigh);
+		if (!FMath::IsNearlyEqual(CurrentCrossoverLow, PreviousCrossoverLow) || !FMath::IsNearlyEqual(CurrentCrossoverHigh, PreviousCrossoverHigh))
 		{
-			// Update the interpolated delay length value
-			if (!CurrentDelayLength.IsDone())
+			BandDecay.SetCrossovers(CurrentCrossoverLow, CurrentCrossoverHigh, SampleRate);
+			PreviousCrossoverLow = CurrentCrossoverLow;
+			PreviousCrossoverHigh = CurrentCrossoverHigh;
+		}
+
+		// The all pass lengths are in samples, but the feedback and final delays are read in ms
+		const float MsToSamples = SampleRate * 0.001f;
+		const float PassLengthLeft = DecayDiffusion1DelayLeft + DecayDiffusion2DelayLeft
+			+ (FeedbackDelayEaseLeft.PeekCurrentValue() + FMath::Clamp(*InFinalDelayLeft, 0, 2000)) * MsToSamples;
+		const float PassLengthRight = DecayDiffusion1DelayRight + DecayDiffusion2DelayRight
+			+ (FeedbackDelayEaseRight.PeekCurrentValue() + FMath::Clamp(*InFinalDelayRight, 0, 2000)) * MsToSamples;
+
+		const float DecayTimes[3] = {
+			GetParameterValue(Audio::EDattorroQueuedParameter::DecayTimeLow),
+			GetParameterValue(Audio::EDattorroQueuedParameter::DecayTimeMid),
+			GetParameterValue(Audio::EDattorroQueuedParameter::DecayTimeHigh) };
+		float GainsLeft[3];
+		float GainsRight[3];
+		for (int32 Band = 0; Band < 3; ++Band)
+		{
+			// -3 / (RT60 * SampleRate) dB per sample, in decades
+			const float DecadesPerSample = -3.0f / (FMath::Clamp(DecayTimes[Band], MinDecayTime, MaxDecayTime) * SampleRate);
+			GainsLeft[Band] = FMath::Pow(10.0f, DecadesPerSample * PassLengthLeft);
+			GainsRight[Band] = FMath::Pow(10.0f, DecadesPerSample * PassLengthRight);
+		}
+		BandDecay.SetGains(GainsLeft, GainsRight);
+	}
+
+	/// Summary
+	///
+	/// Shimmer - a doppler pitch shifter (the same two tap kernel as the Pitch Shift node) run on the tank's own final delays.
+	/// It keeps the read side of the shifter at least a block behind the write position, so every tap for the block
+	/// can be worked out before the per sample tank loop writes anything: the phasor, tap delays and gains are a block kernel,
+	/// and the taps are resolved by block reads of memory the tank already holds. No buffer of its own, but the shifted
+	/// feedback runs a full block behind the plain feedback - a block of latency on the shimmer path round the loop.
+	///
+	/// Summary
+	void FReverberationOperator::ComputeShimmerBlock(int32 InNumFrames)
+	{
+		using namespace Reverberate;
+
+		const float PitchShiftRatio = Audio::GetFrequencyMultiplier(FMath::Clamp(*ShimmerPitch, -MaxAbsShimmerPitch, MaxAbsShimmerPitch));
+		const float WindowSamples = 0.001f * ShimmerWindowLength * SampleRate;
+		const float PhaseIncrement = (1.0f - PitchShiftRatio) / WindowSamples;
+
+		for (int32 FrameIndex = 0; FrameIndex < InNumFrames; ++FrameIndex)
+		{
+			ShimmerPhaseBlock[FrameIndex] = ShimmerPhase;
+
+			ShimmerPhase += PhaseIncrement;
+			if (ShimmerPhase >= 1.0f)
 			{
-				CurrentDelayLength.GetNextValue();
+				ShimmerPhase -= 1.0f;
 			}
-			if(!FeedbackDelayEaseLeft.IsDone())
+			else if (ShimmerPhase < 0.0f)
 			{
-				FeedbackDelayEaseLeft.GetNextValue();
+				ShimmerPhase += 1.0f;
 			}
-			if (!FeedbackDelayEaseRight.IsDone())
+		}
+
+		// Delays are from the write position at the start of the block. Frame i of the loop will have written i more samples,
+		// so InNumFrames - i keeps each tap a full block behind the frame reading it.
+		// The two sine gains are equal power - they can sum to sqrt(2) on correlated taps, which would lift the loop gain round
+		// the tank - so they are divided by their sum to an equal gain crossfade (sin + cos is at least 1, so never a blow up).
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		const VectorRegister4Float Window = VectorSetFloat1(WindowSamples);
+		const VectorRegister4Float FrameOffsets = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+		int32 FrameIndex = 0;
+		for (; FrameIndex + 4 <= InNumFrames; FrameIndex += 4)
+		{
+			const VectorRegister4Float Phase1 = VectorLoad(&ShimmerPhaseBlock[FrameIndex]);
+			const VectorRegister4Float Phase2 = VectorSelect(VectorCompareGE(Phase1, Half), VectorSubtract(Phase1, Half), VectorAdd(Phase1, Half));
+			const VectorRegister4Float FramesAhead = VectorSubtract(VectorSetFloat1((float)(InNumFrames - FrameIndex)), FrameOffsets);
+
+			VectorStore(VectorMultiplyAdd(Window, Phase1, FramesAhead), &ShimmerTapDelay1[FrameIndex]);
+			VectorStore(VectorMultiplyAdd(Window, Phase2, FramesAhead), &ShimmerTapDelay2[FrameIndex]);
+			const VectorRegister4Float Gain1 = Audio::VectorCrossfadeGain(Phase1);
+			const VectorRegister4Float Gain2 = Audio::VectorCrossfadeGain(Phase2);
+			const VectorRegister4Float GainNormalization = VectorReciprocalAccurate(VectorAdd(Gain1, Gain2));
+			VectorStore(VectorMultiply(Gain1, GainNormalization), &ShimmerTapGain1[FrameIndex]);
+			VectorStore(VectorMultiply(Gain2, GainNormalization), &ShimmerTapGain2[FrameIndex]);
+		}
+
+		for (; FrameIndex < InNumFrames; ++FrameIndex)
+		{
+			const float Phase1 = ShimmerPhaseBlock[FrameIndex];
+			const float Phase2 = Phase1 >= 0.5f ? Phase1 - 0.5f : Phase1 + 0.5f;
+			const float FramesAhead = (float)(InNumFrames - FrameIndex);
+
+			ShimmerTapDelay1[FrameIndex] = WindowSamples * Phase1 + FramesAhead;
+			ShimmerTapDelay2[FrameIndex] = WindowSamples * Phase2 + FramesAhead;
+			const float Gain1 = Audio::GetCrossfadeGain(Phase1);
+			const float Gain2 = Audio::GetCrossfadeGain(Phase2);
+			ShimmerTapGain1[FrameIndex] = Gain1 / (Gain1 + Gain2);
+			ShimmerTapGain2[FrameIndex] = Gain2 / (Gain1 + Gain2);
+		}
+
+		// Both final delays share the taps, each mixed into its own shifted block
+		const TArrayView<const float> TapDelay1(ShimmerTapDelay1.GetData(), InNumFrames);
+		const TArrayView<const float> TapDelay2(ShimmerTapDelay2.GetData(), InNumFrames);
+		const TArrayView<float> TapSample1(ShimmerTapSample1.GetData(), InNumFrames);
+		const TArrayView<float> TapSample2(ShimmerTapSample2.GetData(), InNumFrames);
+
+		for (int32 Side = 0; Side < 2; ++Side)
+		{
+			const Audio::FPooledDelay& FinalDelay = Side == 0 ? PostLPFFeedbackDelayLeft : PostLPFFeedbackDelayRight;
+			float* ShimmerOut = Side == 0 ? ShimmerLeft.GetData() : ShimmerRight.GetData();
+
+			FinalDelay.ReadDelaySamplesBlock(TapDelay1, TapSample1);
+			FinalDelay.ReadDelaySamplesBlock(TapDelay2, TapSample2);
+
+			FrameIndex = 0;
+			for (; FrameIndex + 4 <= InNumFrames; FrameIndex += 4)
 			{
-				FeedbackDelayEaseRight.GetNextValue();
+				const VectorRegister4Float Sample1 = VectorMultiply(VectorLoad(&ShimmerTapGain1[FrameIndex]), VectorLoad(&TapSample1[FrameIndex]));
+				VectorStore(VectorMultiplyAdd(VectorLoad(&ShimmerTapGain2[FrameIndex]), VectorLoad(&TapSample2[FrameIndex]), Sample1), &ShimmerOut[FrameIndex]);
 			}
 
-			// Process each audio sample through the all-pass filters
-			float AllPassProcessedSample = 0.0f;
-			float ProcessedSample = LowPassAudio[FrameCount];
-			// Loop through all four all pass filters and add each together.
-			for (int i = 0; i < DelayLengths.Num(); i++)
+			for (; FrameIndex < InNumFrames; ++FrameIndex)
 			{
-				 AllPassProcessedSample += DattorroAllPassFilters[i].ProcessAudioSample(ProcessedSample);
+				ShimmerOut[FrameIndex] = ShimmerTapGain1[FrameIndex] * TapSample1[FrameIndex] + ShimmerTapGain2[FrameIndex] * TapSample2[FrameIndex];
 			}
+		}
+	}
 
-			// assign all pass samples to processed sample variable to continue.
-			ProcessedSample = AllPassProcessedSample;
-			
-			//UE_LOG(LogTemp, Log, TEXT("DelayBuffer: %.1f"), CurrentDelayLength.PeekCurrentValue());
+	void FReverberationOperator::FoldInputChannels(int32 InStartFrame, int32 InNumFrames)
+	{
+		const TArrayView<const float> FoldGains = Reverberate::GetInputFoldGains(NumInputChannels);
+		const float Bandwidth = *PreLowPassFilter;
 
-			const float PhasorReadPosition = CurrentDelayLength.PeekCurrentValue(); // Get the current phase position from the phasor
-			//UE_LOG(LogTemp, Log, TEXT("DelayBuffer: %.6f"), PhasorReadPosition);
-			const float DelayTapRead1 = FMath::Max(PhasorReadPosition, 0.0f);						 // Phasor controls the first delay tap
-			// Add 100 sample tap on delay sample.
-			const float DelayTapRead2 = FMath::Fmod(FMath::Max(PhasorReadPosition + 100, 0.0f), DelayBuffer.GetDelayLengthSamples());						 // The second tap, offset by the phasor increment
-			//UE_LOG(LogTemp, Log, TEXT("Buffer Length: %.1f"), DelayBuffer.GetDelayLengthSamples());
-			
-			// Read the delay lines at the given tap locations, these will be summed together later.
-			const float Sample1 = DelayBuffer.ReadDelayAt(DelayTapRead1);
-			// if Delay tap 2 less than 0, add sample size
-			const float Sample2 = DelayBuffer.ReadDelayAt(DelayTapRead2);
+		const float* ChannelAudio[Reverberate::MaxInputChannels];
+		VectorRegister4Float ChannelGains[Reverberate::MaxInputChannels];
+		for (int32 Channel = 0; Channel < NumInputChannels; Channel++)
+		{
+			ChannelAudio[Channel] = AudioInputs[Channel]->GetData() + InStartFrame;
+			ChannelGains[Channel] = VectorSetFloat1(FoldGains[Channel]);
+		}
 
-			// ------------------------------- Feedback Tail Code -------------------------------
-			// ------------------------------- Left Side of the Feedback Tail ------------------------------
-			
-			float FirstProcessedFeedbackSampleLeft = ProcessedSample;
-			if(FeedbackLeft != NULL) // If there is no value in the feedback loop then skip summing
+		float* Scaled = ScaledAudio.GetData();
+
+		// Each input is read once; the fold and the bandwidth scale are written together, four frames at a time.
+		const VectorRegister4Float BandwidthVector = VectorSetFloat1(Bandwidth);
+		int32 FrameIndex = 0;
+		for (; FrameIndex + 4 <= InNumFrames; FrameIndex += 4)
+		{
+			VectorRegister4Float Sum = VectorMultiply(VectorLoad(ChannelAudio[0] + FrameIndex), ChannelGains[0]);
+			for (int32 Channel = 1; Channel < NumInputChannels; Channel++)
 			{
-				FirstProcessedFeedbackSampleLeft = (ProcessedSample + FeedbackLeft);
+				Sum = VectorMultiplyAdd(VectorLoad(ChannelAudio[Channel] + FrameIndex), ChannelGains[Channel], Sum);
+			}
+
+			VectorStore(VectorMultiply(Sum, BandwidthVector), Scaled + FrameIndex);
+		}
+
+		for (; FrameIndex < InNumFrames; FrameIndex++)
+		{
+			float Sum = 0.0f;
+			for (int32 Channel = 0; Channel < NumInputChannels; Channel++)
+			{
+				Sum += ChannelAudio[Channel][FrameIndex] * FoldGains[Channel];
+			}
+
+			Scaled[FrameIndex] = Sum * Bandwidth;
+		}
+	}
+
+	void FReverberationOperator::MixDryChannels(int32 InStartFrame, int32 InNumFrames, float InDryGain)
+	{
+		const TArrayView<const float> DryMixGains = Reverberate::GetDryMixGains(NumInputChannels, NumOutputChannels);
+
+		for (int32 OutputChannel = 0; OutputChannel < NumOutputChannels; OutputChannel++)
+		{
+			const TArrayView<float> Output(AudioOutputs[OutputChannel]->GetData() + InStartFrame, InNumFrames);
+			FMemory::Memzero(Output.GetData(), InNumFrames * sizeof(float));
+
+			for (int32 InputChannel = 0; InputChannel < NumInputChannels; InputChannel++)
+			{
+				const float Gain = DryMixGains[OutputChannel * NumInputChannels + InputChannel] * InDryGain;
+				if (Gain != 0.0f)
+				{
+					Audio::ArrayMultiplyAddInPlace(TArrayView<const float>(AudioInputs[InputChannel]->GetData() + InStartFrame, InNumFrames), Gain, Output);
+				}
+			}
+		}
+	}
+
+	/// Summary
+	///
+	/// Triggers - every trigger in the block is gathered in frame order and the block is processed in runs between them,
+	/// so each one lands on its own frame. With no triggers this is one run over the whole block, as before.
+	/// Queued parameter changes are split on the same way, ahead of any trigger on their frame.
+	///
+	/// Summary
+	void FReverberationOperator::Execute()
+	{
+		using namespace Reverberate;
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FReverberationOperator::Execute);
+
+		const int32 NumFrames = AudioInputs[0]->Num();
+
+		// Same frame order of actions as the gather below, which the stable sort keeps
+		BlockEvents.Reset();
+		if (ParameterQueue.IsValid() && !bParameterQueueClaimed)
+		{
+			TryClaimParameterQueue();
+		}
+		if (bParameterQueueClaimed)
+		{
+			GatherParameterEvents(NumFrames);
+		}
+		auto AddTriggerEvents = [this](const FTrigger& InTrigger, const ETriggerAction InAction)
+		{
+			for (int32 TriggerIndex = 0; TriggerIndex < InTrigger.Num(); ++TriggerIndex)
+			{
+				BlockEvents.Add({ InTrigger[TriggerIndex], InAction });
+			}
+		};
+		AddTriggerEvents(*ResetTrigger, ETriggerAction::Reset);
+		AddTriggerEvents(*FlushTrigger, ETriggerAction::Flush);
+		AddTriggerEvents(*FreezeTrigger, ETriggerAction::Freeze);
+		AddTriggerEvents(*UnfreezeTrigger, ETriggerAction::Unfreeze);
+		BlockEvents.StableSort([](const FTriggerEvent& A, const FTriggerEvent& B) { return A.Frame < B.Frame; });
+
+		int32 StartFrame = 0;
+		for (const FTriggerEvent& Event : BlockEvents)
+		{
+			const int32 EventFrame = FMath::Clamp(Event.Frame, StartFrame, NumFrames);
+			if (EventFrame > StartFrame)
+			{
+				ProcessFrames(StartFrame, EventFrame - StartFrame);
+				StartFrame = EventFrame;
+			}
+
+			if (Event.Action == ETriggerAction::SetParameter)
+			{
+				ParameterOverrides[(int32)Event.Parameter] = Event.Value;
+				bParameterOverridden[(int32)Event.Parameter] = true;
+			}
+			else
+			{
+				HandleTrigger(Event.Action);
+			}
+		}
+
+		if (StartFrame < NumFrames)
+		{
+			ProcessFrames(StartFrame, NumFrames - StartFrame);
+		}
+	}
+
+	void FReverberationOperator::TryClaimParameterQueue()
+	{
+		bParameterQueueClaimed = ParameterQueue->TryClaimConsumer();
+		if (bParameterQueueClaimed)
+		{
+			for (int32 ParameterIndex = 0; ParameterIndex < Reverberate::NumQueuedParameters; ParameterIndex++)
+			{
+				PreviousPinValues[ParameterIndex] = *GetParameterPin((Audio::EDattorroQueuedParameter)ParameterIndex);
+			}
+		}
+	}
+
+	void FReverberationOperator::GatherParameterEvents(int32 InNumFrames)
+	{
+		using namespace Reverberate;
+
+		// A pin that moved takes its parameter back from the queue
+		for (int32 ParameterIndex = 0; ParameterIndex < NumQueuedParameters; ParameterIndex++)
+		{
+			const float PinValue = *GetParameterPin((Audio::EDattorroQueuedParameter)ParameterIndex);
+			if (PinValue != PreviousPinValues[ParameterIndex])
+			{
+				PreviousPinValues[ParameterIndex] = PinValue;
+				bParameterOverridden[ParameterIndex] = false;
+			}
+		}
+
+		// Records still pending from earlier blocks keep their place ahead of the new ones
+		Audio::FDattorroParameterRecord Record;
+		while (PendingRecords.Num() < (int32)Audio::FDattorroParameterQueue::Capacity && ParameterQueue->Pop(Record))
+		{
+			if (Record.Parameter < Audio::EDattorroQueuedParameter::Num)
+			{
+				PendingRecords.Add(Record);
+			}
+		}
+
+		int32 NumCarried = 0;
+		for (int32 RecordIndex = 0; RecordIndex < PendingRecords.Num(); RecordIndex++)
+		{
+			Audio::FDattorroParameterRecord& Pending = PendingRecords[RecordIndex];
+			if (Pending.SampleOffset < InNumFrames)
+			{
+				BlockEvents.Add({ FMath::Max(Pending.SampleOffset, 0), ETriggerAction::SetParameter, Pending.Parameter, Pending.Value });
+			}
+			else
+			{
+				Pending.SampleOffset -= InNumFrames;
+				PendingRecords[NumCarried++] = Pending;
+			}
+		}
+		PendingRecords.SetNum(NumCarried, EAllowShrinking::No);
+	}
+
+	const FFloatReadRef& FReverberationOperator::GetParameterPin(Audio::EDattorroQueuedParameter InParameter) const
+	{
+		switch (InParameter)
+		{
+		case Audio::EDattorroQueuedParameter::DryValue:
+			return DryValue;
+		case Audio::EDattorroQueuedParameter::DecayRate:
+			return DecayRate;
+		case Audio::EDattorroQueuedParameter::DelayDamping:
+			return DecayDamping;
+		case Audio::EDattorroQueuedParameter::DecayTimeLow:
+			return DecayTimeLow;
+		case Audio::EDattorroQueuedParameter::DecayTimeMid:
+			return DecayTimeMid;
+		case Audio::EDattorroQueuedParameter::DecayTimeHigh:
+			return DecayTimeHigh;
+		case Audio::EDattorroQueuedParameter::ShimmerAmount:
+			return ShimmerAmount;
+		case Audio::EDattorroQueuedParameter::EarlyReflectionsLevel:
+			return EarlyReflectionsLevel;
+		default:
+			return WetValue;
+		}
+	}
+
+	float FReverberationOperator::GetParameterValue(Audio::EDattorroQueuedParameter InParameter) const
+	{
+		const int32 ParameterIndex = (int32)InParameter;
+		return bParameterOverridden[ParameterIndex] ? ParameterOverrides[ParameterIndex] : *GetParameterPin(InParameter);
+	}
+
+	void FReverberationOperator::HandleTrigger(Reverberate::ETriggerAction InAction)
+	{
+		using namespace Reverberate;
+
+		switch (InAction)
+		{
+		case ETriggerAction::Reset:
+			ResetTank();
+			bFlushing = false;
+			FlushGain = 1.0f;
+			break;
+		case ETriggerAction::Flush:
+			// Nothing to flush without a tail, and a flush already under way keeps its fade
+			bFlushing = bDelaysAcquired;
+			break;
+		case ETriggerAction::Freeze:
+			bFrozen = true;
+			break;
+		case ETriggerAction::Unfreeze:
+			// The input stage stood still while frozen - clear what it held so nothing from before the freeze replays on thawing
+			if (bFrozen && bDelaysAcquired)
+			{
+				DelayBuffer.Reset();
+				for (Audio::FPooledDelayAPF& AllPass : DattorroAllPassFilters)
+				{
+					AllPass.Reset();
+				}
+			}
+			bFrozen = false;
+			break;
+		case ETriggerAction::SetParameter:
+			// Applied by Execute itself
+			break;
+		}
+	}
+
+	void FReverberationOperator::ResetTank()
+	{
+		if (bDelaysAcquired)
+		{
+			DelayBuffer.Reset();
+			for (Audio::FPooledDelayAPF& AllPass : DattorroAllPassFilters)
+			{
+				AllPass.Reset();
+			}
+			DecayDiffusionFilter1Left.Reset();
+			DecayDiffusionFilter2Left.Reset();
+			DecayDiffusionFilter1Right.Reset();
+			DecayDiffusionFilter2Right.Reset();
+			FeedbackDelayLeft.Reset();
+			FeedbackDelayRight.Reset();
+			PostLPFFeedbackDelayLeft.Reset();
+			PostLPFFeedbackDelayRight.Reset();
+		}
+
+		LPVariableFilter.Reset();
+		LPDampingFilter.Reset();
+		BandDecay.Reset();
+		EarlyReflections.Reset();
+		FeedbackLeft = 0.0f;
+		FeedbackRight = 0.0f;
+		QuietFrameCount = 0;
+	}
+
+	void FReverberationOperator::ProcessFrames(int32 InStartFrame, int32 InNumFrames)
+	{
+		// NumFrames used for looping over each sample.
+		const int32 NumFrames = InNumFrames;
+
+		// assign input and output audio to variables at the start. Multichannel inputs are folded into the tank input below, unless frozen.
+		const float* InputAudio = AudioInputs[0]->GetData() + InStartFrame;
+
+		// Mono and stereo/front outputs come first; quad adds the two rears
+		float* OutputAudio = AudioOutputs[0]->GetData() + InStartFrame;
+		float* OutputAudioRight = NumOutputChannels > 1 ? AudioOutputs[1]->GetData() + InStartFrame : nullptr;
+		float* OutputAudioRearLeft = NumOutputChannels > 3 ? AudioOutputs[2]->GetData() + InStartFrame : nullptr;
+		float* OutputAudioRearRight = NumOutputChannels > 3 ? AudioOutputs[3]->GetData() + InStartFrame : nullptr;
+
+		// The dry signal goes out first, channel for channel - the wet mix below adds to it
+		MixDryChannels(InStartFrame, NumFrames, GetParameterValue(Audio::EDattorroQueuedParameter::DryValue));
+
+		// ------------------------------- Lazy Delay Memory -------------------------------
+
+		// Check the channels themselves rather than the fold, which out of phase channels could cancel.
+		bool bInputIsSilent = true;
+		for (const FAudioBufferReadRef& Input : AudioInputs)
+		{
+			bInputIsSilent &= Audio::ArrayMaxAbsValue(TArrayView<const float>(Input->GetData() + InStartFrame, NumFrames)) <= Reverberate::SilenceThreshold;
+		}
+
+		if (!bDelaysAcquired && (bInputIsSilent || bFrozen || !AcquireDelays()))
+		{
+			// No tail in flight and nothing coming in (or frozen on nothing, or no memory to run the tank) - only the dry signal remains.
+			return;
+		}
+
+		// In three band mode the band gains take over from Decay Rate and Delay Damping, once per side at the final delay write.
+		// Frozen, the tank has unity gain and no damping at all.
+		const bool bThreeBandDecay = !bFrozen && *DecayMode == EDattorroDecayMode::ThreeBand;
+		DampingMultiplicationValue = (bFrozen || bThreeBandDecay) ? 1.0f : (1 - GetParameterValue(Audio::EDattorroQueuedParameter::DelayDamping));
+		const float DecayRateVariable = (bFrozen || bThreeBandDecay) ? 1.0f : GetParameterValue(Audio::EDattorroQueuedParameter::DecayRate);
+		if (bThreeBandDecay)
+		{
+			UpdateBandDecay();
+		}
+		const float DelayLength = *PreDelayTime;
+		
+		if (bool bDelayCheck = (!FMath::IsNearlyEqual(DelayLength, CurrentDelayLength.GetNextValue())))
+		{
+			//UE_LOG(LogTemp, Log, TEXT("Set Value to PreDelayTime: %.3f"), DelayLength);
+			CurrentDelayLength.SetValue(DelayLength);
+		}
+		
+		// Frozen, nothing new enters the tank, so the input filters, diffusers and pre-delay are left as they are.
+		// Only the tank is cycled, on an empty input.
+		if (bFrozen)
+		{
+			FMemory::Memzero(DiffusedAudio.GetData(), NumFrames * sizeof(float));
+			if (bEarlyReflections)
+			{
+				FMemory::Memzero(EarlyLeft.GetData(), NumFrames * sizeof(float));
+				FMemory::Memzero(EarlyRight.GetData(), NumFrames * sizeof(float));
+			}
+		}
+		else
+		{
+			// apply Low Pass
+			LowPassFilter();
+
+			// multiply by bandwidth value (folded in the same pass for multichannel inputs), then store low pass filter result.
+			if (NumInputChannels == 1)
+			{
+				Audio::ArrayMultiplyByConstant(TArrayView<const float>(InputAudio, NumFrames), *PreLowPassFilter, TArrayView<float>(ScaledAudio.GetData(), NumFrames));
+			}
+			else
+			{
+				FoldInputChannels(InStartFrame, NumFrames);
+			}
+			LPVariableFilter.ProcessAudio(ScaledAudio.GetData(), NumFrames, LowPassAudio.GetData());
+
+			// Setup All Pass
+			AllPassFilter();
+
+			// ------------------------------- Input Diffusion -------------------------------
+
+			// The input side never sees the tank, so it is run for the whole block before the per sample tank loop.
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+			{
+				// Loop through all four all pass filters and add each together.
+				float AllPassProcessedSample = 0.0f;
+				for (int i = 0; i < DelayLengths.Num(); i++)
+				{
+					AllPassProcessedSample += DattorroAllPassFilters[i].ProcessAudioSample(LowPassAudio[FrameIndex]);
+				}
+
+				for (int i = 0; i < DelayLengths.Num(); i++)
+				{
+					DattorroAllPassFilters[i].WriteDelayAndInc(AllPassProcessedSample);
+				}
+
+				DiffusedAudio[FrameIndex] = AllPassProcessedSample;
+			}
+
+			// Write the new block to the pre-delay (for the delay reads below) - converted to the storage format in one pass.
+			DelayBuffer.WriteBlock(TArrayView<const float>(DiffusedAudio.GetData(), NumFrames));
+
+			// ------------------------------- Early Reflections -------------------------------
+
+			// The whole block of reflections is gathered from the freshly written pre-delay before the tank loop
+			if (bEarlyReflections)
+			{
+				const float CurrentRoomSize = FMath::Clamp(*RoomSize, Reverberate::MinRoomSize, Reverberate::MaxRoomSize);
+				const float CurrentEarlyReflectionsLevel = FMath::Clamp(GetParameterValue(Audio::EDattorroQueuedParameter::EarlyReflectionsLevel), 0.0f, 1.0f);
+				if (!FMath::IsNearlyEqual(CurrentRoomSize, PreviousRoomSize) || !FMath::IsNearlyEqual(CurrentEarlyReflectionsLevel, PreviousEarlyReflectionsLevel))
+				{
+					EarlyReflections.SetRoom(Reverberate::GetEarlyReflectionRoom(*EarlyReflectionsRoom), CurrentRoomSize, CurrentEarlyReflectionsLevel);
+					PreviousRoomSize = CurrentRoomSize;
+					PreviousEarlyReflectionsLevel = CurrentEarlyReflectionsLevel;
+				}
+
+				EarlyReflections.ProcessBlock(DelayBuffer, NumFrames, EarlyLeft.GetData(), EarlyRight.GetData());
+			}
+		}
+
+		// ------------------------------- Excursion -------------------------------
+
+		// Build this block's modulated delay lengths for the first decay diffusion filters up front,
+		// so the tank loop only does a fractional read per sample.
+		const float CurrentExcursionRate = FMath::Clamp(*ExcursionRate, 0.0f, Reverberate::MaxExcursionRate);
+		if (!FMath::IsNearlyEqual(CurrentExcursionRate, PreviousExcursionRate))
+		{
+			ExcursionOscillator.SetFrequency(CurrentExcursionRate, SampleRate);
+			PreviousExcursionRate = CurrentExcursionRate;
+		}
+
+		const float CurrentExcursionDepth = FMath::Clamp(*ExcursionDepth, 0.0f, Reverberate::MaxExcursionDepth);
+		ExcursionOscillator.GenerateBlock(ExcursionDelayLeft.GetData(), ExcursionDelayRight.GetData(), NumFrames, CurrentExcursionDepth);
+		Audio::ArrayAddConstantInplace(TArrayView<float>(ExcursionDelayLeft.GetData(), NumFrames), DecayDiffusion1DelayLeft);
+		Audio::ArrayAddConstantInplace(TArrayView<float>(ExcursionDelayRight.GetData(), NumFrames), DecayDiffusion1DelayRight);
+
+		const bool bDattorroOutputTaps = *OutputTapsMode == EDattorroOutputTaps::Dattorro;
+		if (bDattorroOutputTaps)
+		{
+			UpdateOutputTaps();
+		}
+
+		// The shimmer only reads the final delays further back than this block will write, so it can run ahead as a block kernel
+		const float CurrentShimmerAmount = bWithShimmer ? FMath::Clamp(GetParameterValue(Audio::EDattorroQueuedParameter::ShimmerAmount), 0.0f, 1.0f) : 0.0f;
+		if (bWithShimmer)
+		{
+			ComputeShimmerBlock(NumFrames);
+		}
+
+		// used to change the phase increment on pitch shift - not used fully.
+		const float NewDelayLengthClamped = GetDelayLengthClamped();
+		bool bRecomputePhasorIncrement = (!FMath::IsNearlyEqual(NewDelayLengthClamped, CurrentDelayLength.GetNextValue()));
+		if (bRecomputePhasorIncrement)
+		{
+			//UE_LOG(LogTemp, Log, TEXT("Set Value to PreDelayTime: %.3f"), CurrentDelayLength.PeekCurrentValue());
+			PhasorPhaseIncrement = GetPhasorPhaseIncrement(); 
+		}
+		
+		const float CurrentWetValue = GetParameterValue(Audio::EDattorroQueuedParameter::WetValue);
+
+		// mix original and low pass
+		for (int32 FrameCount = 0; FrameCount < NumFrames; FrameCount++)
+		{
+			// A flush fades the wet path out a frame at a time
+			float WetGain = CurrentWetValue;
+			if (bFlushing)
+			{
+				WetGain *= FlushGain;
+				FlushGain = FMath::Max(FlushGain - FlushGainStep, 0.0f);
+			}
+
+			// Update the interpolated delay length value
+			if (!CurrentDelayLength.IsDone())
+			{
+				CurrentDelayLength.GetNextValue();
+			}
+			if(!FeedbackDelayEaseLeft.IsDone())
+			{
+				FeedbackDelayEaseLeft.GetNextValue();
+			}
+			if (!FeedbackDelayEaseRight.IsDone())
+			{
+				FeedbackDelayEaseRight.GetNextValue();
+			}
+
+			// The all pass processed sample for this frame.
+			const float ProcessedSample = DiffusedAudio[FrameCount];
+			
+			//UE_LOG(LogTemp, Log, TEXT("DelayBuffer: %.1f"), CurrentDelayLength.PeekCurrentValue());
+
+			const float PhasorReadPosition = CurrentDelayLength.PeekCurrentValue(); // Get the current phase position from the phasor
+			//UE_LOG(LogTemp, Log, TEXT("DelayBuffer: %.6f"), PhasorReadPosition);
+			const float DelayTapRead1 = FMath::Max(PhasorReadPosition, 0.0f);						 // Phasor controls the first delay tap
+			// Add 100 sample tap on delay sample.
+			const float DelayTapRead2 = FMath::Fmod(FMath::Max(PhasorReadPosition + 100, 0.0f), DelayBuffer.GetDelayLengthSamples());						 // The second tap, offset by the phasor increment
+			//UE_LOG(LogTemp, Log, TEXT("Buffer Length: %.1f"), DelayBuffer.GetDelayLengthSamples());
+			
+			// Read the delay lines at the given tap locations, these will be summed together later.
+			// The block is already written, so each read reaches back past the frames that come after this one.
+			const int32 FramesAhead = NumFrames - FrameCount;
+			// The classic taps are only read when they are mixed in.
+			// Frozen, the pre-delay holds a stale block, so its taps drop out too.
+			const bool bSkipPreDelayTaps = bDattorroOutputTaps || bFrozen;
+			const float Sample1 = bSkipPreDelayTaps ? 0.0f : ReadPreDelayTap(DelayTapRead1, FramesAhead);
+			// if Delay tap 2 less than 0, add sample size
+			const float Sample2 = bSkipPreDelayTaps ? 0.0f : ReadPreDelayTap(DelayTapRead2, FramesAhead);
+
+			// ------------------------------- Feedback Tail Code -------------------------------
+			// ------------------------------- Left Side of the Feedback Tail ------------------------------
+			
+			float FirstProcessedFeedbackSampleLeft = ProcessedSample;
+			if(FeedbackLeft != NULL) // If there is no value in the feedback loop then skip summing
+			{
+				FirstProcessedFeedbackSampleLeft = (ProcessedSample + FeedbackLeft);
+			}
+
+			// The left side is fed from the right final delay, so it takes that line's shifted past.
+			// A crossfade rather than a sum, and the shifted signal's own taps are an equal gain crossfade, so the shimmer never raises the loop gain.
+			if (bWithShimmer)
+			{
+				FirstProcessedFeedbackSampleLeft = ProcessedSample + (1.0f - CurrentShimmerAmount) * FeedbackLeft + CurrentShimmerAmount * ShimmerRight[FrameCount];
 			}
 
 			// ------------------------------- Left - All Pass Filter - Diffuse 1 -------------------------------
 			
-			FirstProcessedFeedbackSampleLeft = DecayDiffusionFilter1Left.ProcessAudioSample(FirstProcessedFeedbackSampleLeft);
+			FirstProcessedFeedbackSampleLeft = DecayDiffusionFilter1Left.ProcessAudioSampleAt(FirstProcessedFeedbackSampleLeft, ExcursionDelayLeft[FrameCount]);
 
 			// ------------------------------- Left - First Delay -------------------------------
 
@@ -628,7 +1926,7 @@ namespace Metasound
 			
 			//UE_LOG(LogTemp, Log, TEXT("ReadPos: %.2f"), FeedbackReadPosition);
 			
-			const float FeedbackSampleLeft = FeedbackDelayLeft.ReadDelayAt(FMath::Fmod(FMath::Max(FeedbackReadPosition, 0.0f), FeedbackDelayLeft.GetDelayLengthSamples()));	
+			const float FeedbackSampleLeft = bDattorroOutputTaps ? 0.0f : FeedbackDelayLeft.ReadDelayAt(FMath::Fmod(FMath::Max(FeedbackReadPosition, 0.0f), FeedbackDelayLeft.GetDelayLengthSamples()));	
 			
 			// ----------------------------- Left - Low-pass filter - Damping -----------------------------
 			
@@ -639,7 +1937,14 @@ namespace Metasound
 			
 			float LowPassFeedbackSampleLeft = 0.0f;
 			
-			LPDampingFilter.ProcessAudioFrame(&FinalProcessedFeedbackSampleLeft, &LowPassFeedbackSampleLeft);
+			if (bFrozen)
+			{
+				LowPassFeedbackSampleLeft = FinalProcessedFeedbackSampleLeft;
+			}
+			else
+			{
+				LPDampingFilter.ProcessAudioFrame(&FinalProcessedFeedbackSampleLeft, &LowPassFeedbackSampleLeft);
+			}
 			
 
 			// ------------------------------- Left - Decay Sound -------------------------------
@@ -654,7 +1959,7 @@ namespace Metasound
 			
 			const float LeftSampleFinalDelay = FMath::Clamp(*InFinalDelayLeft, 0, 2000);
 			
-			const float FinalFeedbackSampleLeft = PostLPFFeedbackDelayLeft.ReadDelayAt(LeftSampleFinalDelay);
+			const float FinalFeedbackSampleLeft = bDattorroOutputTaps ? 0.0f : PostLPFFeedbackDelayLeft.ReadDelayAt(LeftSampleFinalDelay);
 
 			// ------------------------------- Left - Decay Sound  -------------------------------
 			
@@ -668,16 +1973,21 @@ namespace Metasound
 				FirstProcessedFeedbackSampleRight = (ProcessedSample + FeedbackRight);
 			}
 
+			if (bWithShimmer)
+			{
+				FirstProcessedFeedbackSampleRight = ProcessedSample + (1.0f - CurrentShimmerAmount) * FeedbackRight + CurrentShimmerAmount * ShimmerLeft[FrameCount];
+			}
+
 			// ------------------------------- Right - All Pass Filter - Diffuse 1 -------------------------------
 			
-			FirstProcessedFeedbackSampleRight = DecayDiffusionFilter1Right.ProcessAudioSample(FirstProcessedFeedbackSampleRight);
+			FirstProcessedFeedbackSampleRight = DecayDiffusionFilter1Right.ProcessAudioSampleAt(FirstProcessedFeedbackSampleRight, ExcursionDelayRight[FrameCount]);
 
 			// ------------------------------- Right - First Delay -------------------------------
 
 			// Get the FeedbackReadPosition from the ease function
 			FeedbackReadPosition = FeedbackDelayEaseRight.PeekCurrentValue();
 
-			const float FeedbackSampleRight = FeedbackDelayRight.ReadDelayAt(FMath::Fmod(FMath::Max(FeedbackReadPosition, 0.0f), FeedbackDelayRight.GetDelayLengthSamples()));
+			const float FeedbackSampleRight = bDattorroOutputTaps ? 0.0f : FeedbackDelayRight.ReadDelayAt(FMath::Fmod(FMath::Max(FeedbackReadPosition, 0.0f), FeedbackDelayRight.GetDelayLengthSamples()));
 
 			// ------------------------------- Right - Low-pass filter (damping) -------------------------------
 
@@ -688,7 +1998,14 @@ namespace Metasound
 
 			float LowPassFeedbackSampleRight = 0.0f;
 			
-			LPDampingFilter.ProcessAudioFrame(&FinalProcessedFeedbackSampleRight, &LowPassFeedbackSampleRight);
+			if (bFrozen)
+			{
+				LowPassFeedbackSampleRight = FinalProcessedFeedbackSampleRight;
+			}
+			else
+			{
+				LPDampingFilter.ProcessAudioFrame(&FinalProcessedFeedbackSampleRight, &LowPassFeedbackSampleRight);
+			}
 
 			// ------------------------------- Right - Decay Sound -------------------------------
 			
@@ -701,7 +2018,7 @@ namespace Metasound
 			// ------------------------------- Right - Final Delay -------------------------------
 			
 			const float RightSampleFinalDelay = FMath::Clamp(*InFinalDelayRight, 0, 2000);
-			const float FinalFeedbackSampleRight = PostLPFFeedbackDelayRight.ReadDelayAt(RightSampleFinalDelay);
+			const float FinalFeedbackSampleRight = bDattorroOutputTaps ? 0.0f : PostLPFFeedbackDelayRight.ReadDelayAt(RightSampleFinalDelay);
 
 			// ------------------------------- Right - Decay Sound  -------------------------------
 
@@ -709,23 +2026,127 @@ namespace Metasound
 			
 			// ------------------------------- Process & Write Outputs -------------------------------
 
-			// Mix the original (InputAudio) with the all-pass processed audio
-			const float OriginalSample = InputAudio[FrameCount];
-
 			// The delayed signal, mix the two delay taps together
 			const float DelayedSample = Sample1 + Sample2;
 
-			// Mix all output samples into one sample.
-			const float MixedSample = (OriginalSample * *DryValue) 
-			+ (DelayedSample * *WetValue)
-			+ (FeedbackSampleLeft * *WetValue) + (FeedbackSampleRight * *WetValue)
-			+ (FinalFeedbackSampleLeft * *WetValue) + (FinalFeedbackSampleRight * *WetValue);
+			if (bDattorroOutputTaps)
+			{
+				// Gather every tap from the index table in one pass - the reads are independent, so they pipeline.
+				float Taps[Reverberate::NumOutputTaps];
+				for (int32 TapIndex = 0; TapIndex < Reverberate::NumOutputTaps; TapIndex++)
+				{
+					Taps[TapIndex] = OutputTapLines[TapIndex]->ReadTap(OutputTapDelays[TapIndex]);
+				}
+
+				// Each output splits into the taps from the opposite half of the tank (direct) and from its own half (cross)
+				const float LeftDirect = Reverberate::OutputTapGain * (Taps[0] + Taps[1] - Taps[2] + Taps[3]);
+				const float LeftCross = Reverberate::OutputTapGain * (-Taps[4] - Taps[5] - Taps[6]);
+				const float RightDirect = Reverberate::OutputTapGain * (Taps[7] + Taps[8] - Taps[9] + Taps[10]);
+				const float RightCross = Reverberate::OutputTapGain * (-Taps[11] - Taps[12] - Taps[13]);
+
+				switch (NumOutputChannels)
+				{
+				case 2:
+					OutputAudio[FrameCount] += ((LeftDirect + LeftCross) * WetGain);
+					OutputAudioRight[FrameCount] += ((RightDirect + RightCross) * WetGain);
+					break;
+				case 4:
+					// The rears take the difference of the two groups, which is uncorrelated with their sum in the fronts
+					OutputAudio[FrameCount] += ((LeftDirect + LeftCross) * WetGain);
+					OutputAudioRight[FrameCount] += ((RightDirect + RightCross) * WetGain);
+					OutputAudioRearLeft[FrameCount] += (LeftDirect - LeftCross) * WetGain;
+					OutputAudioRearRight[FrameCount] += (RightDirect - RightCross) * WetGain;
+					break;
+				default:
+					OutputAudio[FrameCount] += ((LeftDirect + LeftCross + RightDirect + RightCross) * WetGain);
+					break;
+				}
+			}
+			else
+			{
+				// Classic taps
+				switch (NumOutputChannels)
+				{
+				case 2:
+					// Each side keeps its own half of the tank
+					OutputAudio[FrameCount] += ((Sample1 + FeedbackSampleLeft + FinalFeedbackSampleLeft) * WetGain);
+					OutputAudioRight[FrameCount] += ((Sample2 + FeedbackSampleRight + FinalFeedbackSampleRight) * WetGain);
+					break;
+				case 4:
+					// Early taps to the front with the dry signal, the later final delays to the rear
+					OutputAudio[FrameCount] += ((Sample1 + FeedbackSampleLeft) * WetGain);
+					OutputAudioRight[FrameCount] += ((Sample2 + FeedbackSampleRight) * WetGain);
+					OutputAudioRearLeft[FrameCount] += FinalFeedbackSampleLeft * WetGain;
+					OutputAudioRearRight[FrameCount] += FinalFeedbackSampleRight * WetGain;
+					break;
+				default:
+				{
+					// Mix all output samples into one sample.
+					const float MixedSample = (DelayedSample * WetGain)
+					+ (FeedbackSampleLeft * WetGain) + (FeedbackSampleRight * WetGain)
+					+ (FinalFeedbackSampleLeft * WetGain) + (FinalFeedbackSampleRight * WetGain);
+
+					// Add this mixed sample to the dry signal already in the output
+					OutputAudio[FrameCount] += MixedSample;
+					break;
+				}
+			}
+			}
+
+			// Early reflections join the wet mix - each side to its own output, or the fronts in quad
+			if (bEarlyReflections)
+			{
+				if (OutputAudioRight)
+				{
+					OutputAudio[FrameCount] += EarlyLeft[FrameCount] * WetGain;
+					OutputAudioRight[FrameCount] += EarlyRight[FrameCount] * WetGain;
+				}
+				else
+				{
+					OutputAudio[FrameCount] += (EarlyLeft[FrameCount] + EarlyRight[FrameCount]) * WetGain;
+				}
+			}
 
-			// Set output frame to this mixed sample
-			OutputAudio[FrameCount] = MixedSample;
+			// Both sides' final delay inputs in one pass of the band split
+			if (bThreeBandDecay)
+			{
+				BandDecay.ProcessFrame(FinalProcessedFeedbackSampleLeft, FinalProcessedFeedbackSampleRight);
+			}
 
 			// Write all delays using samples.
-			WriteDelaysAndInc(ProcessedSample, FirstProcessedFeedbackSampleLeft, FirstProcessedFeedbackSampleRight, FinalProcessedFeedbackSampleLeft, FinalProcessedFeedbackSampleRight);
+			WriteDelaysAndInc(FirstProcessedFeedbackSampleLeft, FirstProcessedFeedbackSampleRight, FinalProcessedFeedbackSampleLeft, FinalProcessedFeedbackSampleRight);
+		}
+
+		// Give the delay memory back once both the input and the tail have been silent for longer than any line can hold a sample.
+		bool bOutputIsSilent = true;
+		for (const FAudioBufferWriteRef& Output : AudioOutputs)
+		{
+			bOutputIsSilent &= Audio::ArrayMaxAbsValue(TArrayView<const float>(Output->GetData() + InStartFrame, NumFrames)) <= Reverberate::SilenceThreshold;
+		}
+
+		// A finished flush drops the tail outright - the node stays dry only until the next input
+		if (bFlushing && FlushGain <= 0.0f)
+		{
+			ReleaseDelays();
+			ResetTank();
+			bFlushing = false;
+			bFrozen = false;
+			FlushGain = 1.0f;
+			return;
+		}
+
+		// A frozen tail is kept even if it is not being heard
+		if (bInputIsSilent && bOutputIsSilent && !bFrozen)
+		{
+			QuietFrameCount += NumFrames;
+			if (QuietFrameCount >= TailHoldFrames)
+			{
+				ReleaseDelays();
+			}
+		}
+		else
+		{
+			QuietFrameCount = 0;
 		}
 	}
 
@@ -737,63 +2158,125 @@ namespace Metasound
 	///In our case, the default pitch shift is reasonably 0.0 semitones. 
 	///
 	/// Summary
-	const FVertexInterface& FReverberationOperator::GetVertexInterface()
+	FInputVertexInterface FReverberationOperator::MakeInputInterface(const int32 InNumInputChannels, const bool bInWithShimmer)
 	{
 		using namespace Reverberate;
 
-		static const FVertexInterface Interface(
-			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDelay), 50.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreLPF), 1.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamLowPassCutOff), 500.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAllPassCutOff), 0.4f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDiffuse_1), 0.750f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDiffuse_2), 0.625f),
-
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayRate), 0.1f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFeedbackDelay_1), 80.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayDiffusion_1), 0.7f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayDiffusion_2), 0.5f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayDamping), 0.005f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamRandomDelay), 16.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFeedbackDelay_2), 60.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFinalDelay_1), 120.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFinalDelay_2), 100.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamWetValue), 0.65f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDryValue), 0.35f)
-			),
-			FOutputVertexInterface(
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
-			)
+		FInputVertexInterface InputInterface;
+		switch (InNumInputChannels)
+		{
+		case 8:
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputRight)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputCenter)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLFE)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputBackLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputBackRight)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideRight)));
+			break;
+		case 6:
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputRight)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputCenter)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLFE)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideRight)));
+			break;
+		case 4:
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputRight)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputSideRight)));
+			break;
+		case 2:
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputLeft)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInputRight)));
+			break;
+		default:
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)));
+			break;
+		}
+
+		const FInputVertexInterface ParameterInterface(
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDelay), 50.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreLPF), 1.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamLowPassCutOff), 500.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAllPassCutOff), 0.4f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDiffuse_1), 0.750f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamPreDiffuse_2), 0.625f),
+
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayRate), 0.1f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFeedbackDelay_1), 80.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayDiffusion_1), 0.7f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayDiffusion_2), 0.5f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayDamping), 0.005f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamRandomDelay), 16.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamExcursionDepth), 16.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamExcursionRate), 1.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFeedbackDelay_2), 60.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFinalDelay_1), 120.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFinalDelay_2), 100.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamWetValue), 0.65f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDryValue), 0.35f),
+			TInputDataVertex<FEnumDattorroDelayStorage>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDelayStorage), (int32)EDattorroDelayStorage::Float32),
+			TInputDataVertex<FEnumDattorroOutputTaps>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamOutputTaps), (int32)EDattorroOutputTaps::Classic),
+			TInputDataVertex<FEnumDattorroDecayMode>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayMode), (int32)EDattorroDecayMode::Rate),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayTimeLow), 3.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayTimeMid), 2.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayTimeHigh), 0.8f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamCrossoverLow), 250.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamCrossoverHigh), 4000.0f),
+			TInputDataVertex<FEnumDattorroEarlyReflections>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamEarlyReflections), (int32)EDattorroEarlyReflections::Off),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamRoomSize), 1.0f),
+			TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamEarlyReflectionsLevel), 0.5f),
+			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamReset)),
+			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFlush)),
+			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFreeze)),
+			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamUnfreeze)),
+			TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamInstanceId), 0)
 		);
 
-		return Interface;
-	}
+		for (const FInputDataVertex& Vertex : ParameterInterface)
+		{
+			InputInterface.Add(Vertex);
+		}
 
-	
-	const FNodeClassMetadata& FReverberationOperator::GetNodeInfo()
-	{
-		auto InitNodeInfo = []() -> FNodeClassMetadata
+		if (bInWithShimmer)
 		{
-			FNodeClassMetadata Info;
-			Info.ClassName = { StandardNodes::Namespace, "Reverberation", StandardNodes::AudioVariant };
-			Info.MajorVersion = 1;
-			Info.MinorVersion = 1;
-			Info.DisplayName = METASOUND_LOCTEXT("ReverbNode_DisplayName", "Dattorro Reverberation");
-			Info.Description = METASOUND_LOCTEXT("ReverbNode_Description", "Reverberates the Audio Input.");
-			Info.Author = PluginAuthor;
-			Info.PromptIfMissing = PluginNodeMissingPrompt;
-			Info.DefaultInterface = GetVertexInterface();
-			Info.CategoryHierarchy.Emplace(NodeCategories::Functions);
-			return Info;
-		};
+			InputInterface.Add(TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamShimmerAmount), 0.3f));
+			InputInterface.Add(TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamShimmerPitch), 12.0f));
+		}
 
-		static const FNodeClassMetadata Info = InitNodeInfo();
+		return InputInterface;
+	}
 
-		return Info;
+	FOutputVertexInterface FReverberationOperator::MakeOutputInterface(const int32 InNumOutputChannels)
+	{
+		using namespace Reverberate;
+
+		switch (InNumOutputChannels)
+		{
+		case 2:
+			return FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioLeft)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioRight))
+			);
+		case 4:
+			return FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioFrontLeft)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioFrontRight)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioRearLeft)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudioRearRight))
+			);
+		default:
+			return FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+			);
+		}
 	}
 
+
 	/// Summary
 	///
 	/// So the thing that does the thing in MetaSounds is an IOperator.
@@ -804,14 +2287,19 @@ namespace Metasound
 	/// Here is where you retrieve your input references and pass them to your object and also allocate your write references (that your object owns).
 	///
 	/// Summary
-	TUniquePtr<IOperator> FReverberationOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	TUniquePtr<IOperator> FReverberationOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors, const int32 InNumInputChannels, const int32 InNumOutputChannels, const bool bInWithShimmer)
 	{
 		using namespace Reverberate;
 
 		const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		// Only the audio pins differ between layouts, so the mono shimmer interface supplies the parameter defaults for all of them.
+		static const FInputVertexInterface InputInterface = MakeInputInterface(1, true);
 
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
+		TArray<FAudioBufferReadRef> AudioIn;
+		for (const TCHAR* AudioInputName : GetAudioInputNames(InNumInputChannels))
+		{
+			AudioIn.Add(InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(AudioInputName, InParams.OperatorSettings));
+		}
 		FFloatReadRef PreDelayTime = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamPreDelay), InParams.OperatorSettings);
 		FFloatReadRef PreLowPassFilter = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamPreLPF), InParams.OperatorSettings);
 		FFloatReadRef LowPassCutoff = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamLowPassCutOff), InParams.OperatorSettings);
@@ -826,6 +2314,8 @@ namespace Metasound
 		FFloatReadRef DelayDamping = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayDamping), InParams.OperatorSettings);
 
 		FFloatReadRef RandomDelays = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamRandomDelay), InParams.OperatorSettings);
+		FFloatReadRef ExcursionDepth = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamExcursionDepth), InParams.OperatorSettings);
+		FFloatReadRef ExcursionRate = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamExcursionRate), InParams.OperatorSettings);
 		FFloatReadRef FeedbackDelay2 = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamFeedbackDelay_2), InParams.OperatorSettings);
 
 		FFloatReadRef FinalDelay1 = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamFinalDelay_1), InParams.OperatorSettings);
@@ -834,23 +2324,312 @@ namespace Metasound
 		FFloatReadRef WetValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamWetValue), InParams.OperatorSettings);
 		FFloatReadRef DryValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDryValue), InParams.OperatorSettings);
 
-		return MakeUnique<FReverberationOperator>(InParams.OperatorSettings, AudioIn, PreDelayTime, PreLowPassFilter, LowPassCutoff, AllPassCutoff, InputDiffusion1, InputDiffusion2, DecayRate, FeedbackDelay1, DecayDiffusion1, DecayDiffusion2, DelayDamping, RandomDelays, FeedbackDelay2, FinalDelay1, FinalDelay2, WetValue, DryValue);
+		FEnumDattorroDelayStorageReadRef DelayStorage = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroDelayStorage>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDelayStorage), InParams.OperatorSettings);
+		FEnumDattorroOutputTapsReadRef OutputTapsMode = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroOutputTaps>(InputInterface, METASOUND_GET_PARAM_NAME(InParamOutputTaps), InParams.OperatorSettings);
+
+		FEnumDattorroDecayModeReadRef DecayMode = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroDecayMode>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayMode), InParams.OperatorSettings);
+		FFloatReadRef DecayTimeLow = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayTimeLow), InParams.OperatorSettings);
+		FFloatReadRef DecayTimeMid = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayTimeMid), InParams.OperatorSettings);
+		FFloatReadRef DecayTimeHigh = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayTimeHigh), InParams.OperatorSettings);
+		FFloatReadRef CrossoverLow = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamCrossoverLow), InParams.OperatorSettings);
+		FFloatReadRef CrossoverHigh = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamCrossoverHigh), InParams.OperatorSettings);
+
+		FEnumDattorroEarlyReflectionsReadRef EarlyReflectionsRoom = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumDattorroEarlyReflections>(InputInterface, METASOUND_GET_PARAM_NAME(InParamEarlyReflections), InParams.OperatorSettings);
+		FFloatReadRef RoomSize = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamRoomSize), InParams.OperatorSettings);
+		FFloatReadRef EarlyReflectionsLevel = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamEarlyReflectionsLevel), InParams.OperatorSettings);
+
+		FTriggerReadRef Reset = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamReset), InParams.OperatorSettings);
+		FTriggerReadRef Flush = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamFlush), InParams.OperatorSettings);
+		FTriggerReadRef Freeze = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamFreeze), InParams.OperatorSettings);
+		FTriggerReadRef Unfreeze = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamUnfreeze), InParams.OperatorSettings);
+
+		FInt32ReadRef InstanceId = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamInstanceId), InParams.OperatorSettings);
+
+		// Plain reverb nodes have no shimmer pins, so these are just the defaults there (and never read)
+		FFloatReadRef ShimmerAmount = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamShimmerAmount), InParams.OperatorSettings);
+		FFloatReadRef ShimmerPitch = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamShimmerPitch), InParams.OperatorSettings);
+
+		return MakeUnique<FReverberationOperator>(InParams.OperatorSettings, AudioIn, PreDelayTime, PreLowPassFilter, LowPassCutoff, AllPassCutoff, InputDiffusion1, InputDiffusion2, DecayRate, FeedbackDelay1, DecayDiffusion1, DecayDiffusion2, DelayDamping, RandomDelays, ExcursionDepth, ExcursionRate, FeedbackDelay2, FinalDelay1, FinalDelay2, WetValue, DryValue, DelayStorage, OutputTapsMode, DecayMode, DecayTimeLow, DecayTimeMid, DecayTimeHigh, CrossoverLow, CrossoverHigh, EarlyReflectionsRoom, RoomSize, EarlyReflectionsLevel, Reset, Flush, Freeze, Unfreeze, ShimmerAmount, ShimmerPitch, InstanceId, bInWithShimmer, InNumOutputChannels);
+	}
+
+	/// Summary
+	///
+	/// Offline rendering - the operator is built straight from the settings, with its own input buffers in place of a graph's,
+	/// and executed block by block at the block size a MetaSound would run at. The render ends once the input is used up and
+	/// the operator has handed its delay memory back (its own test for a tail that has died away), or at MaxTailTime.
+	///
+	/// Summary
+	TUniquePtr<FReverberationOperator> FReverberationOperator::MakeOfflineOperator(const FDattorroReverbRenderSettings& InSettings, const FOperatorSettings& InOperatorSettings, const TArray<FAudioBufferReadRef>& InAudioInputs)
+	{
+		auto MakeFloat = [](float InValue) { return FFloatReadRef::CreateNew(InValue); };
+		auto MakeTrigger = [&InOperatorSettings]() { return FTriggerReadRef::CreateNew(InOperatorSettings); };
+
+		return MakeUnique<FReverberationOperator>(InOperatorSettings, InAudioInputs,
+			MakeFloat(InSettings.PreDelayTime), MakeFloat(InSettings.PreLowPassFilterBandwidth), MakeFloat(InSettings.LowPassCutOff), MakeFloat(InSettings.AllPassCutoff),
+			MakeFloat(InSettings.InputDiffusion1), MakeFloat(InSettings.InputDiffusion2),
+			MakeFloat(InSettings.DecayRate), MakeFloat(InSettings.FeedbackDelayLeft), MakeFloat(InSettings.DecayDiffusion1), MakeFloat(InSettings.DecayDiffusion2),
+			MakeFloat(InSettings.DelayDamping), MakeFloat(InSettings.RandomDelay), MakeFloat(InSettings.ExcursionDepth), MakeFloat(InSettings.ExcursionRate),
+			MakeFloat(InSettings.FeedbackDelayRight), MakeFloat(InSettings.FinalDelayLeft), MakeFloat(InSettings.FinalDelayRight),
+			MakeFloat(InSettings.WetValue), MakeFloat(InSettings.DryValue),
+			FEnumDattorroDelayStorageReadRef::CreateNew(EDattorroDelayStorage::Float32),
+			FEnumDattorroOutputTapsReadRef::CreateNew(InSettings.bDattorroOutputTaps ? EDattorroOutputTaps::Dattorro : EDattorroOutputTaps::Classic),
+			FEnumDattorroDecayModeReadRef::CreateNew(InSettings.bThreeBandDecay ? EDattorroDecayMode::ThreeBand : EDattorroDecayMode::Rate),
+			MakeFloat(InSettings.DecayTimeLow), MakeFloat(InSettings.DecayTimeMid), MakeFloat(InSettings.DecayTimeHigh),
+			MakeFloat(InSettings.CrossoverLow), MakeFloat(InSettings.CrossoverHigh),
+			FEnumDattorroEarlyReflectionsReadRef::CreateNew((EDattorroEarlyReflections)InSettings.EarlyReflections),
+			MakeFloat(InSettings.RoomSize), MakeFloat(InSettings.EarlyReflectionsLevel),
+			MakeTrigger(), MakeTrigger(), MakeTrigger(), MakeTrigger(),
+			MakeFloat(InSettings.ShimmerAmount), MakeFloat(InSettings.ShimmerPitch),
+			FInt32ReadRef::CreateNew(0),
+			InSettings.bWithShimmer, InSettings.NumOutputChannels);
+	}
+
+	bool FReverberationOperator::RenderOffline(const FDattorroReverbRenderSettings& InSettings, TConstArrayView<float> InInterleaved, int32 InNumInputChannels, float InSampleRate, TArray<float>& OutInterleaved)
+	{
+		using namespace Reverberate;
+
+		const int32 NumOutputChannels = InSettings.NumOutputChannels;
+		const bool bValidInputChannels = InSettings.bWithShimmer ? InNumInputChannels == 1 : GetInputFoldGains(InNumInputChannels).Num() == InNumInputChannels;
+		const bool bValidOutputChannels = NumOutputChannels == 1 || NumOutputChannels == 2 || NumOutputChannels == 4;
+		if (!bValidInputChannels || !bValidOutputChannels || InSampleRate <= 0.0f || InInterleaved.Num() % InNumInputChannels != 0)
+		{
+			return false;
+		}
+
+		// 100 blocks a second, as the engine's MetaSounds run by default
+		const FOperatorSettings OperatorSettings(InSampleRate, 100.0f);
+		const int32 NumBlockFrames = OperatorSettings.GetNumFramesPerBlock();
+
+		TArray<FAudioBufferWriteRef> InputBuffers;
+		TArray<FAudioBufferReadRef> AudioInputs;
+		for (int32 Channel = 0; Channel < InNumInputChannels; Channel++)
+		{
+			InputBuffers.Add(FAudioBufferWriteRef::CreateNew(OperatorSettings));
+			AudioInputs.Add(FAudioBufferReadRef(InputBuffers.Last()));
+		}
+
+		TUniquePtr<FReverberationOperator> Operator = MakeOfflineOperator(InSettings, OperatorSettings, AudioInputs);
+
+		const int32 NumInputFrames = InInterleaved.Num() / InNumInputChannels;
+		const int32 MaxFrames = NumInputFrames + FMath::Max(FMath::CeilToInt(InSettings.MaxTailTime * InSampleRate), 0);
+		OutInterleaved.Reset(MaxFrames * NumOutputChannels);
+
+		int32 Frame = 0;
+		while (Frame < MaxFrames)
+		{
+			// Past the end of the input the operator runs on silence
+			const int32 NumInputBlockFrames = FMath::Clamp(NumInputFrames - Frame, 0, NumBlockFrames);
+			if (NumInputBlockFrames == 0 && !Operator->bDelaysAcquired && Frame > 0)
+			{
+				break;
+			}
+
+			for (int32 Channel = 0; Channel < InNumInputChannels; Channel++)
+			{
+				float* InputData = InputBuffers[Channel]->GetData();
+				for (int32 FrameIndex = 0; FrameIndex < NumInputBlockFrames; FrameIndex++)
+				{
+					InputData[FrameIndex] = InInterleaved[(Frame + FrameIndex) * InNumInputChannels + Channel];
+				}
+				FMemory::Memzero(InputData + NumInputBlockFrames, (NumBlockFrames - NumInputBlockFrames) * sizeof(float));
+			}
+
+			Operator->Execute();
+
+			const int32 NumOutputBlockFrames = FMath::Min(NumBlockFrames, MaxFrames - Frame);
+			const int32 FirstOutputSample = OutInterleaved.AddUninitialized(NumOutputBlockFrames * NumOutputChannels);
+			for (int32 Channel = 0; Channel < NumOutputChannels; Channel++)
+			{
+				const float* OutputData = Operator->AudioOutputs[Channel]->GetData();
+				for (int32 FrameIndex = 0; FrameIndex < NumOutputBlockFrames; FrameIndex++)
+				{
+					OutInterleaved[FirstOutputSample + FrameIndex * NumOutputChannels + Channel] = OutputData[FrameIndex];
+				}
+			}
+			Frame += NumOutputBlockFrames;
+		}
+
+		// The operator holds its delays for a while after the tail goes quiet - none of that is worth keeping
+		int32 NumKeptSamples = OutInterleaved.Num();
+		while (NumKeptSamples > NumInputFrames * NumOutputChannels && FMath::Abs(OutInterleaved[NumKeptSamples - 1]) <= SilenceThreshold)
+		{
+			NumKeptSamples--;
+		}
+		OutInterleaved.SetNum(FMath::DivideAndRoundUp(NumKeptSamples, NumOutputChannels) * NumOutputChannels, EAllowShrinking::No);
+
+		return true;
+	}
+
+	bool RenderReverberationOffline(const FDattorroReverbRenderSettings& InSettings, TConstArrayView<float> InInterleaved, int32 InNumInputChannels, float InSampleRate, TArray<float>& OutInterleaved)
+	{
+		return FReverberationOperator::RenderOffline(InSettings, InInterleaved, InNumInputChannels, InSampleRate, OutInterleaved);
+	}
+
+	double TimeReverberationBlocks(int32 InNumBlocks, float InSampleRate)
+	{
+		const FOperatorSettings OperatorSettings(InSampleRate, 100.0f);
+		FAudioBufferWriteRef Input = FAudioBufferWriteRef::CreateNew(OperatorSettings);
+
+		FDattorroReverbRenderSettings Settings;
+		Settings.NumOutputChannels = 1;
+		TUniquePtr<FReverberationOperator> Operator = FReverberationOperator::MakeOfflineOperator(Settings, OperatorSettings, { FAudioBufferReadRef(Input) });
+
+		return TimeBlocksOfNoise(TArrayView<float>(Input->GetData(), Input->Num()), InNumBlocks, [&Operator]() { Operator->Execute(); });
+	}
+
+	/// Summary
+	///
+	/// The node facing side of the reverb - one per input and output layout, all sharing FReverberationOperator for the processing.
+	/// Mono in keeps the original class names and pins, so existing graphs load unchanged.
+	/// The shimmer nodes are the same operator with the shifter switched on and two extra pins.
+	///
+	/// Summary
+	template<int32 NumInputChannels, int32 NumOutputChannels, bool bWithShimmer = false>
+	class TReverberationOperator : public FReverberationOperator
+	{
+	public:
+		// Returns metadata such as node name, type, etc
+		static const FNodeClassMetadata& GetNodeInfo();
+		// Returns the interface for the input and output vertex (connection points for data flow)
+		static const FVertexInterface& GetVertexInterface();
+		// Creates and returns a new instance of the operator, initializing it with the provided parameters.
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+		{
+			return FReverberationOperator::CreateOperator(InParams, OutErrors, NumInputChannels, NumOutputChannels, bWithShimmer);
+		}
+	};
+
+	template<int32 NumInputChannels, int32 NumOutputChannels, bool bWithShimmer>
+	const FVertexInterface& TReverberationOperator<NumInputChannels, NumOutputChannels, bWithShimmer>::GetVertexInterface()
+	{
+		static const FVertexInterface Interface(MakeInputInterface(NumInputChannels, bWithShimmer), MakeOutputInterface(NumOutputChannels));
+
+		return Interface;
+	}
+
+	template<int32 NumInputChannels, int32 NumOutputChannels, bool bWithShimmer>
+	const FNodeClassMetadata& TReverberationOperator<NumInputChannels, NumOutputChannels, bWithShimmer>::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.MajorVersion = 1;
+			if (bWithShimmer)
+			{
+				Info.MinorVersion = 0;
+				switch (NumOutputChannels)
+				{
+				case 2:
+					Info.ClassName = { StandardNodes::Namespace, "Shimmer Reverberation", "Stereo" };
+					Info.DisplayName = METASOUND_LOCTEXT("ShimmerReverbNodeStereo_DisplayName", "Dattorro Shimmer Reverberation (Stereo)");
+					break;
+				case 4:
+					Info.ClassName = { StandardNodes::Namespace, "Shimmer Reverberation", "Quad" };
+					Info.DisplayName = METASOUND_LOCTEXT("ShimmerReverbNodeQuad_DisplayName", "Dattorro Shimmer Reverberation (Quad)");
+					break;
+				default:
+					Info.ClassName = { StandardNodes::Namespace, "Shimmer Reverberation", StandardNodes::AudioVariant };
+					Info.DisplayName = METASOUND_LOCTEXT("ShimmerReverbNode_DisplayName", "Dattorro Shimmer Reverberation");
+					break;
+				}
+			}
+			else if (NumInputChannels > 1)
+			{
+				// Multichannel in - named by both channel counts, e.g. "6 In 2 Out"
+				Info.ClassName = { StandardNodes::Namespace, "Reverberation", *FString::Printf(TEXT("%d In %d Out"), NumInputChannels, NumOutputChannels) };
+				Info.MinorVersion = 0;
+				Info.DisplayName = FText::Format(METASOUND_LOCTEXT("ReverbNodeMultichannel_DisplayName", "Dattorro Reverberation ({0} In, {1} Out)"), NumInputChannels, NumOutputChannels);
+			}
+			else
+			{
+				switch (NumOutputChannels)
+				{
+				case 2:
+					Info.ClassName = { StandardNodes::Namespace, "Reverberation", "Stereo" };
+					Info.MinorVersion = 0;
+					Info.DisplayName = METASOUND_LOCTEXT("ReverbNodeStereo_DisplayName", "Dattorro Reverberation (Stereo)");
+					break;
+				case 4:
+					Info.ClassName = { StandardNodes::Namespace, "Reverberation", "Quad" };
+					Info.MinorVersion = 0;
+					Info.DisplayName = METASOUND_LOCTEXT("ReverbNodeQuad_DisplayName", "Dattorro Reverberation (Quad)");
+					break;
+				default:
+					Info.ClassName = { StandardNodes::Namespace, "Reverberation", StandardNodes::AudioVariant };
+					Info.MinorVersion = 1;
+					Info.DisplayName = METASOUND_LOCTEXT("ReverbNode_DisplayName", "Dattorro Reverberation");
+					break;
+				}
+			}
+			Info.Description = bWithShimmer
+				? METASOUND_LOCTEXT("ShimmerReverbNode_Description", "Reverberates the Audio Input, pitch shifting the tail on every trip round the tank.")
+				: METASOUND_LOCTEXT("ReverbNode_Description", "Reverberates the Audio Input.");
+			Info.Author = PluginAuthor;
+			Info.PromptIfMissing = PluginNodeMissingPrompt;
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Functions);
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
 	}
 
-	class FReverbNode : public FNodeFacade
+	template<int32 NumInputChannels, int32 NumOutputChannels, bool bWithShimmer = false>
+	class TReverbNode : public FNodeFacade
 	{
 	public:
 		/**
 		 * Constructor used by the Metasound Frontend.
 		 */
-		FReverbNode(const FNodeInitData& InitData)
-			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FReverberationOperator>())
+		TReverbNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<TReverberationOperator<NumInputChannels, NumOutputChannels, bWithShimmer>>())
 		{
 		}
 	};
 
+	using FReverbNode = TReverbNode<1, 1>;
+	using FStereoReverbNode = TReverbNode<1, 2>;
+	using FQuadReverbNode = TReverbNode<1, 4>;
+
+	// Multichannel inputs, each with a mono, stereo and quad output
+	using FReverbNode2In1Out = TReverbNode<2, 1>;
+	using FReverbNode2In2Out = TReverbNode<2, 2>;
+	using FReverbNode2In4Out = TReverbNode<2, 4>;
+	using FReverbNode4In1Out = TReverbNode<4, 1>;
+	using FReverbNode4In2Out = TReverbNode<4, 2>;
+	using FReverbNode4In4Out = TReverbNode<4, 4>;
+	using FReverbNode6In1Out = TReverbNode<6, 1>;
+	using FReverbNode6In2Out = TReverbNode<6, 2>;
+	using FReverbNode6In4Out = TReverbNode<6, 4>;
+	using FReverbNode8In1Out = TReverbNode<8, 1>;
+	using FReverbNode8In2Out = TReverbNode<8, 2>;
+	using FReverbNode8In4Out = TReverbNode<8, 4>;
+
+	// Shimmer, mono in
+	using FShimmerReverbNode = TReverbNode<1, 1, true>;
+	using FStereoShimmerReverbNode = TReverbNode<1, 2, true>;
+	using FQuadShimmerReverbNode = TReverbNode<1, 4, true>;
 
 	METASOUND_REGISTER_NODE(FReverbNode)
+	METASOUND_REGISTER_NODE(FStereoReverbNode)
+	METASOUND_REGISTER_NODE(FQuadReverbNode)
+	METASOUND_REGISTER_NODE(FReverbNode2In1Out)
+	METASOUND_REGISTER_NODE(FReverbNode2In2Out)
+	METASOUND_REGISTER_NODE(FReverbNode2In4Out)
+	METASOUND_REGISTER_NODE(FReverbNode4In1Out)
+	METASOUND_REGISTER_NODE(FReverbNode4In2Out)
+	METASOUND_REGISTER_NODE(FReverbNode4In4Out)
+	METASOUND_REGISTER_NODE(FReverbNode6In1Out)
+	METASOUND_REGISTER_NODE(FReverbNode6In2Out)
+	METASOUND_REGISTER_NODE(FReverbNode6In4Out)
+	METASOUND_REGISTER_NODE(FReverbNode8In1Out)
+	METASOUND_REGISTER_NODE(FReverbNode8In2Out)
+	METASOUND_REGISTER_NODE(FReverbNode8In4Out)
+	METASOUND_REGISTER_NODE(FShimmerReverbNode)
+	METASOUND_REGISTER_NODE(FStereoShimmerReverbNode)
+	METASOUND_REGISTER_NODE(FQuadShimmerReverbNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,413 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Internationalization/Text.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundFacade.h"
+#include "DSP/FloatArrayMath.h"
+#include "Math/RandomStream.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "DattorroDelayPool.h"
+#include "DattorroOfflineRender.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodesVelvetReverberation"
+
+namespace Metasound
+{
+	namespace VelvetReverberate
+	{
+		// METASOUND_PARAM: Variable Name - Node Name - Node Description.
+		// -------------------- Input --------------------
+		METASOUND_PARAM(InParamAudioInput, "In", "Incoming Audio Signal")
+		METASOUND_PARAM(InParamDecayTime, "Decay Time", "Time in seconds for the tail to fall by 60 dB (RT60).") // clamp between 0.1 and 2.5
+		METASOUND_PARAM(InParamDensity, "Density", "Pulses per second in the velvet noise. Cost per sample is Density x Decay Time taps, capped at 1024.") // clamp between 100 and 4000
+		METASOUND_PARAM(InParamDamping, "Damping", "One-pole low pass on the signal entering the tail. 0 is bright, 1 is dark.") // clamp between 0 and 0.95
+		METASOUND_PARAM(InParamWetValue, "Wet Value", "How strong the reverberated sound is") // clamp between 0 and 1
+		METASOUND_PARAM(InParamDryValue, "Dry Value", "How strong the base sound is") // clamp between 0 and 1
+
+		// -------------------- Outputs --------------------
+		METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
+
+		static constexpr float MinDecayTime = 0.1f;
+		static constexpr float MaxDecayTime = 2.5f;
+		static constexpr float MinDensity = 100.0f;
+		static constexpr float MaxDensity = 4000.0f;
+		static constexpr float MaxDamping = 0.95f;
+
+		// Hard cap on taps per sample, so the cost stays bounded whatever the inputs
+		static constexpr int32 MaxTaps = 1024;
+
+		// Each segment of the tail gets one gain, stepping down the RT60 curve
+		static constexpr int32 NumSegments = 16;
+
+		// Peak level below which a block counts as silent (roughly -100 dBFS).
+		static constexpr float SilenceThreshold = 1.0e-5f;
+
+		// Fixed seed so every instance (and every rebuild) has the same pulse pattern
+		static constexpr int32 PulseSeed = 0x5EED;
+	}
+
+	/// Summary
+	///
+	/// Velvet noise reverb - the cheapest tail in the plugin, meant for the lowest quality tier and distant voices.
+	/// The impulse response is a precomputed sparse sequence of +/-1 pulses (one per grid period, at a random offset in it),
+	/// with the tail split into segments whose gains follow the RT60 decay.
+	/// Rendering is a tap gather over a single delay buffer. The gather runs a block at a time - each pulse adds a scaled,
+	/// contiguous slice of the buffer to the wet block - so every tap is a vectorised multiply-add over streaming memory
+	/// rather than a scattered load per sample.
+	///
+	/// Summary
+	class FVelvetReverbOperator : public TExecutableOperator<FVelvetReverbOperator>
+	{
+	public:
+
+		// Returns metadata such as node name, type, etc
+		static const FNodeClassMetadata& GetNodeInfo();
+		// Returns the interface for the input and output vertex (connection points for data flow)
+		static const FVertexInterface& GetVertexInterface();
+		// Creates and returns a new instance of the operator, initializing it with the provided parameters.
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		FVelvetReverbOperator(const FOperatorSettings& InSettings,
+			const FAudioBufferReadRef& InAudioInput,
+			const FFloatReadRef& InDecayTime,
+			const FFloatReadRef& InDensity,
+			const FFloatReadRef& InDamping,
+			const FFloatReadRef& InWetValue,
+			const FFloatReadRef& InDryValue);
+
+		virtual ~FVelvetReverbOperator();
+
+		// Returns the inputs for the operator (usually audio data or control parameters).
+		virtual FDataReferenceCollection GetInputs() const override;
+
+		// Returns the outputs of the operator (usually processed audio data).
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		// Executes the velvet noise reverberation
+		void Execute();
+
+	private:
+		// Rebuilds the pulse table when the decay time or density change.
+		void UpdatePulseTable();
+
+		// -------------------- Inputs --------------------
+		FAudioBufferReadRef AudioInput;
+		FFloatReadRef DecayTime;
+		FFloatReadRef Density;
+		FFloatReadRef Damping;
+		FFloatReadRef WetValue;
+		FFloatReadRef DryValue;
+
+		// -------------------- Outputs --------------------
+		FAudioBufferWriteRef AudioOutput;
+
+		float SampleRate = 0.0f;
+
+		// Single delay buffer holding the (damped) input, power of two long so wrapping is a mask.
+		// Long enough for the furthest pulse plus one block, since the whole block is written before the gather.
+		Audio::FDelayBlock DelayBlock;
+		float* DelayMemory = nullptr;
+		int32 DelayCapacity = 0;
+		int32 WriteIndex = 0;
+
+		// Pulse table: delay of each pulse in samples, and its sign times its segment gain.
+		TArray<int32> PulseOffsets;
+		TArray<float> PulseGains;
+		int32 NumPulses = 0;
+
+		// Scratch block the pulses are accumulated into
+		TArray<float> WetAudio;
+
+		float PreviousDecayTime{ -1.f };
+		float PreviousDensity{ -1.f };
+
+		// Damping one-pole state
+		float DampingState = 0.0f;
+
+		int32 QuietFrameCount = 0;
+	};
+
+	FVelvetReverbOperator::FVelvetReverbOperator(const FOperatorSettings& InSettings,
+		const FAudioBufferReadRef& InAudioInput,
+		const FFloatReadRef& InDecayTime,
+		const FFloatReadRef& InDensity,
+		const FFloatReadRef& InDamping,
+		const FFloatReadRef& InWetValue,
+		const FFloatReadRef& InDryValue)
+
+		: AudioInput(InAudioInput)
+		, DecayTime(InDecayTime)
+		, Density(InDensity)
+		, Damping(InDamping)
+		, WetValue(InWetValue)
+		, DryValue(InDryValue)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, SampleRate(InSettings.GetSampleRate())
+	{
+		DelayCapacity = (int32)FMath::RoundUpToPowerOfTwo((uint32)(FMath::CeilToInt(VelvetReverberate::MaxDecayTime * SampleRate) + 1 + InSettings.GetNumFramesPerBlock()));
+		WetAudio.SetNumZeroed(InSettings.GetNumFramesPerBlock());
+
+		// Sized once for the worst case so rebuilding the table never allocates
+		PulseOffsets.SetNumZeroed(VelvetReverberate::MaxTaps);
+		PulseGains.SetNumZeroed(VelvetReverberate::MaxTaps);
+
+		UpdatePulseTable();
+	}
+
+	FVelvetReverbOperator::~FVelvetReverbOperator()
+	{
+		Audio::FDelayBlockPool::Get().Release(DelayBlock);
+	}
+
+	FDataReferenceCollection FVelvetReverbOperator::GetInputs() const
+	{
+		using namespace VelvetReverberate;
+
+		FDataReferenceCollection InputDataReferences;
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDecayTime), FFloatReadRef(DecayTime));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDensity), FFloatReadRef(Density));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDamping), FFloatReadRef(Damping));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamWetValue), FFloatReadRef(WetValue));
+		InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDryValue), FFloatReadRef(DryValue));
+
+		return InputDataReferences;
+	}
+
+	FDataReferenceCollection FVelvetReverbOperator::GetOutputs() const
+	{
+		using namespace VelvetReverberate;
+
+		FDataReferenceCollection OutputDataReferences;
+		OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+		return OutputDataReferences;
+	}
+
+	void FVelvetReverbOperator::UpdatePulseTable()
+	{
+		using namespace VelvetReverberate;
+
+		const float CurrentDecayTime = FMath::Clamp(*DecayTime, MinDecayTime, MaxDecayTime);
+		const float CurrentDensity = FMath::Clamp(*Density, MinDensity, MaxDensity);
+
+		if (FMath::IsNearlyEqual(CurrentDecayTime, PreviousDecayTime) && FMath::IsNearlyEqual(CurrentDensity, PreviousDensity))
+		{
+			return;
+		}
+
+		// The tail runs until it is 60 dB down. Thin the pulses out if that would take more taps than the cap.
+		const float TailSamples = CurrentDecayTime * SampleRate;
+		const float EffectiveDensity = FMath::Min(CurrentDensity, MaxTaps / CurrentDecayTime);
+		const float GridPeriod = SampleRate / EffectiveDensity;
+		const int32 NewNumPulses = FMath::Min((int32)(TailSamples / GridPeriod), MaxTaps);
+
+		// Unit energy for a constant gain sequence is 1 / sqrt(pulses); the decay only takes energy away from that
+		const float Normalise = 1.0f / FMath::Sqrt((float)FMath::Max(NewNumPulses, 1));
+		const float SegmentLength = TailSamples / NumSegments;
+
+		FRandomStream Random(PulseSeed);
+		for (int32 PulseIndex = 0; PulseIndex < NewNumPulses; ++PulseIndex)
+		{
+			// One pulse per grid period at a random position within it, with a random sign. Offset by one so the dry sample is never in the tail.
+			const int32 Offset = 1 + (int32)((PulseIndex + Random.FRand()) * GridPeriod);
+			const float Sign = Random.FRand() < 0.5f ? -1.0f : 1.0f;
+
+			// Exponentially decaying segments: every pulse in a segment shares the gain at the segment's centre
+			const int32 Segment = FMath::Min((int32)(Offset / SegmentLength), NumSegments - 1);
+			const float SegmentCentreSeconds = (Segment + 0.5f) * SegmentLength / SampleRate;
+			const float SegmentGain = FMath::Pow(10.0f, -3.0f * SegmentCentreSeconds / CurrentDecayTime);
+
+			PulseOffsets[PulseIndex] = Offset;
+			PulseGains[PulseIndex] = Sign * SegmentGain * Normalise;
+		}
+
+		NumPulses = NewNumPulses;
+
+		PreviousDecayTime = CurrentDecayTime;
+		PreviousDensity = CurrentDensity;
+	}
+
+	void FVelvetReverbOperator::Execute()
+	{
+		using namespace VelvetReverberate;
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FVelvetReverbOperator::Execute);
+
+		const float* InputAudio = AudioInput->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumFrames = AudioInput->Num();
+
+		// ------------------------------- Lazy Delay Memory -------------------------------
+
+		const bool bInputIsSilent = Audio::ArrayMaxAbsValue(TArrayView<const float>(InputAudio, NumFrames)) <= SilenceThreshold;
+		if (DelayMemory == nullptr)
+		{
+			if (!bInputIsSilent)
+			{
+				DelayBlock = Audio::FDelayBlockPool::Get().Acquire(DelayCapacity * sizeof(float));
+				DelayMemory = static_cast<float*>(DelayBlock.Data);
+				WriteIndex = 0;
+				DampingState = 0.0f;
+				QuietFrameCount = 0;
+			}
+
+			if (DelayMemory == nullptr)
+			{
+				// No tail in flight and nothing coming in - only the dry signal remains.
+				Audio::ArrayMultiplyByConstant(TArrayView<const float>(InputAudio, NumFrames), *DryValue, TArrayView<float>(OutputAudio, NumFrames));
+				return;
+			}
+		}
+
+		UpdatePulseTable();
+
+		const float DampingCoefficient = FMath::Clamp(*Damping, 0.0f, MaxDamping);
+		const int32 WrapMask = DelayCapacity - 1;
+
+		// Damp the input and write the whole block into the buffer first - every pulse is at least one sample late, so the gather below only reads what has been written
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			DampingState = InputAudio[FrameIndex] + DampingCoefficient * (DampingState - InputAudio[FrameIndex]);
+			DelayMemory[(WriteIndex + FrameIndex) & WrapMask] = DampingState;
+		}
+
+		// Sparse convolution: each pulse adds its gain times the buffer, delayed by its offset, to the whole wet block
+		TArrayView<float> Wet(WetAudio.GetData(), NumFrames);
+		FMemory::Memzero(Wet.GetData(), NumFrames * sizeof(float));
+
+		for (int32 PulseIndex = 0; PulseIndex < NumPulses; ++PulseIndex)
+		{
+			const float PulseGain = PulseGains[PulseIndex];
+			int32 ReadIndex = (WriteIndex - PulseOffsets[PulseIndex]) & WrapMask;
+
+			// At most two contiguous runs, either side of the wrap
+			int32 FramesDone = 0;
+			while (FramesDone < NumFrames)
+			{
+				const int32 RunLength = FMath::Min(NumFrames - FramesDone, DelayCapacity - ReadIndex);
+				Audio::ArrayMultiplyAddInPlace(TArrayView<const float>(DelayMemory + ReadIndex, RunLength), PulseGain, Wet.Slice(FramesDone, RunLength));
+				FramesDone += RunLength;
+				ReadIndex = (ReadIndex + RunLength) & WrapMask;
+			}
+		}
+
+		const float WetGain = *WetValue;
+		const float DryGain = *DryValue;
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			OutputAudio[FrameIndex] = (InputAudio[FrameIndex] * DryGain) + (Wet[FrameIndex] * WetGain);
+		}
+
+		WriteIndex = (WriteIndex + NumFrames) & WrapMask;
+
+		// Give the buffer back once the input has been silent for longer than the longest tap.
+		if (bInputIsSilent)
+		{
+			QuietFrameCount += NumFrames;
+			if (QuietFrameCount >= DelayCapacity)
+			{
+				Audio::FDelayBlockPool::Get().Release(DelayBlock);
+				DelayMemory = nullptr;
+			}
+		}
+		else
+		{
+			QuietFrameCount = 0;
+		}
+	}
+
+	const FVertexInterface& FVelvetReverbOperator::GetVertexInterface()
+	{
+		using namespace VelvetReverberate;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDecayTime), 1.2f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDensity), 200.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDamping), 0.4f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamWetValue), 0.65f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDryValue), 0.35f)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FVelvetReverbOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.ClassName = { StandardNodes::Namespace, "Velvet Reverberation", StandardNodes::AudioVariant };
+			Info.MajorVersion = 1;
+			Info.MinorVersion = 0;
+			Info.DisplayName = METASOUND_LOCTEXT("VelvetReverbNode_DisplayName", "Velvet Noise Reverberation");
+			Info.Description = METASOUND_LOCTEXT("VelvetReverbNode_Description", "Very cheap reverb tail from sparse velvet noise. Intended for distant and low priority voices.");
+			Info.Author = PluginAuthor;
+			Info.PromptIfMissing = PluginNodeMissingPrompt;
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Functions);
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	TUniquePtr<IOperator> FVelvetReverbOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	{
+		using namespace VelvetReverberate;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
+		FFloatReadRef DecayTime = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDecayTime), InParams.OperatorSettings);
+		FFloatReadRef Density = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDensity), InParams.OperatorSettings);
+		FFloatReadRef Damping = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDamping), InParams.OperatorSettings);
+		FFloatReadRef WetValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamWetValue), InParams.OperatorSettings);
+		FFloatReadRef DryValue = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDryValue), InParams.OperatorSettings);
+
+		return MakeUnique<FVelvetReverbOperator>(InParams.OperatorSettings, AudioIn, DecayTime, Density, Damping, WetValue, DryValue);
+	}
+
+	double TimeVelvetReverbBlocks(int32 InNumBlocks, float InSampleRate)
+	{
+		const FOperatorSettings OperatorSettings(InSampleRate, 100.0f);
+		FAudioBufferWriteRef Input = FAudioBufferWriteRef::CreateNew(OperatorSettings);
+
+		// The node's pin defaults
+		FVelvetReverbOperator Operator(OperatorSettings, Input, FFloatReadRef::CreateNew(1.2f), FFloatReadRef::CreateNew(200.0f),
+			FFloatReadRef::CreateNew(0.4f), FFloatReadRef::CreateNew(0.65f), FFloatReadRef::CreateNew(0.35f));
+
+		return TimeBlocksOfNoise(TArrayView<float>(Input->GetData(), Input->Num()), InNumBlocks, [&Operator]() { Operator.Execute(); });
+	}
+
+	class FVelvetReverbNode : public FNodeFacade
+	{
+	public:
+		/**
+		 * Constructor used by the Metasound Frontend.
+		 */
+		FVelvetReverbNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FVelvetReverbOperator>())
+		{
+		}
+	};
+
+
+	METASOUND_REGISTER_NODE(FVelvetReverbNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "DattorroPooledDelay.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DattorroPooledDelayTests
+{
+	constexpr float SampleRate = 48000.0f;
+	constexpr float DelaySamples = 250.0f;
+	constexpr float G = 0.7f;
+	constexpr int32 NumFrames = 48000;
+
+	// A 440 Hz sine - smooth enough that any step in the output comes from the filter, not the input
+	float GetInput(const int32 InFrame)
+	{
+		return 0.5f * FMath::Sin(2.0f * PI * 440.0f * InFrame / SampleRate);
+	}
+
+	void InitAllPass(Audio::FPooledDelayAPF& OutAllPass)
+	{
+		OutAllPass.Init(SampleRate, 0.01f);
+		OutAllPass.SetG(G);
+		OutAllPass.SetDelaySamples(DelaySamples);
+		OutAllPass.Acquire();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDattorroModulatedAllPassDepthZeroTest, "Audio.DattorroReverb.PooledDelay.ModulatedAllPassAtDepthZero",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDattorroModulatedAllPassDepthZeroTest::RunTest(const FString& Parameters)
+{
+	using namespace DattorroPooledDelayTests;
+
+	Audio::FPooledDelayAPF Fixed;
+	Audio::FPooledDelayAPF Modulated;
+	InitAllPass(Fixed);
+	InitAllPass(Modulated);
+
+	// With no excursion the per sample read is the fixed read, so the two filters must match sample for sample
+	float MaxError = 0.0f;
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const float Input = Frame == 0 ? 1.0f : GetInput(Frame);
+		const float FixedOut = Fixed.ProcessAudioSample(Input);
+		const float ModulatedOut = Modulated.ProcessAudioSampleAt(Input, DelaySamples);
+		MaxError = FMath::Max(MaxError, FMath::Abs(FixedOut - ModulatedOut));
+	}
+
+	TestTrue(FString::Printf(TEXT("Modulated all pass at depth 0 follows the fixed one (max error %g)"), MaxError), MaxError <= 1.0e-6f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDattorroModulatedAllPassSmoothnessTest, "Audio.DattorroReverb.PooledDelay.ModulatedAllPassIsSmooth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDattorroModulatedAllPassSmoothnessTest::RunTest(const FString& Parameters)
+{
+	using namespace DattorroPooledDelayTests;
+
+	Audio::FPooledDelayAPF Fixed;
+	Audio::FPooledDelayAPF Modulated;
+	InitAllPass(Fixed);
+	InitAllPass(Modulated);
+
+	// The reverb's deepest excursion, swept at its fastest rate
+	constexpr float Depth = 32.0f;
+	constexpr float Rate = 10.0f;
+
+	// A modulated delay bends the pitch slightly but never jumps, so its largest step between samples stays close to the
+	// fixed filter's. Reading across interleaved or stale slots would show up as steps far larger than that.
+	float MaxFixedStep = 0.0f;
+	float MaxModulatedStep = 0.0f;
+	float PreviousFixed = 0.0f;
+	float PreviousModulated = 0.0f;
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const float Input = GetInput(Frame);
+		const float Excursion = Depth * FMath::Sin(2.0f * PI * Rate * Frame / SampleRate);
+		const float FixedOut = Fixed.ProcessAudioSample(Input);
+		const float ModulatedOut = Modulated.ProcessAudioSampleAt(Input, DelaySamples + Excursion);
+
+		if (Frame > 0)
+		{
+			MaxFixedStep = FMath::Max(MaxFixedStep, FMath::Abs(FixedOut - PreviousFixed));
+			MaxModulatedStep = FMath::Max(MaxModulatedStep, FMath::Abs(ModulatedOut - PreviousModulated));
+		}
+		PreviousFixed = FixedOut;
+		PreviousModulated = ModulatedOut;
+	}
+
+	TestTrue(FString::Printf(TEXT("Modulated all pass is smooth (max step %g, fixed %g)"), MaxModulatedStep, MaxFixedStep), MaxModulatedStep <= 1.25f * MaxFixedStep);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDattorroDelayStorageQualityTest, "Audio.DattorroReverb.PooledDelay.StorageQuality",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDattorroDelayStorageQualityTest::RunTest(const FString& Parameters)
+{
+	using namespace DattorroPooledDelayTests;
+
+	constexpr int32 NumSamples = 4800;
+	const Audio::EDelayStorageFormat Formats[] = { Audio::EDelayStorageFormat::Float32, Audio::EDelayStorageFormat::Float16, Audio::EDelayStorageFormat::Int16 };
+	const TCHAR* FormatNames[] = { TEXT("32-bit Float"), TEXT("16-bit Float"), TEXT("16-bit Integer") };
+
+	// Round trips a sine at each level through each storage format, against the float it went in as
+	for (int32 FormatIndex = 0; FormatIndex < UE_ARRAY_COUNT(Formats); FormatIndex++)
+	{
+		Audio::FPooledDelay Delay;
+		Delay.Init(SampleRate, 0.2f, Formats[FormatIndex]);
+		Delay.Acquire();
+
+		FString Report = FString::Printf(TEXT("%s, %d bytes for a 200 ms line - SNR"), FormatNames[FormatIndex], Delay.GetRequiredBytes());
+		for (float LevelDb = 0.0f; LevelDb >= -60.0f; LevelDb -= 20.0f)
+		{
+			const float Amplitude = FMath::Pow(10.0f, LevelDb / 20.0f);
+			for (int32 Sample = 0; Sample < NumSamples; Sample++)
+			{
+				Delay.WriteDelayAndInc(Amplitude * FMath::Sin(2.0f * PI * 440.0f * Sample / SampleRate));
+			}
+
+			double SignalPower = 0.0;
+			double NoisePower = 0.0;
+			for (int32 Sample = 0; Sample < NumSamples; Sample++)
+			{
+				const float Original = Amplitude * FMath::Sin(2.0f * PI * 440.0f * Sample / SampleRate);
+				const float Stored = Delay.ReadDelaySamples((float)(NumSamples - Sample));
+				SignalPower += Original * Original;
+				NoisePower += (Stored - Original) * (Stored - Original);
+			}
+			// A lossless round trip has no noise at all - reported as such rather than as an infinite ratio
+			const double SnrDb = NoisePower > 0.0 ? 10.0 * FMath::LogX(10.0, SignalPower / NoisePower) : TNumericLimits<double>::Max();
+			Report += NoisePower > 0.0 ? FString::Printf(TEXT(" %.0f dB at %.0f dBFS,"), SnrDb, LevelDb) : FString::Printf(TEXT(" lossless at %.0f dBFS,"), LevelDb);
+
+			if (Formats[FormatIndex] == Audio::EDelayStorageFormat::Float16)
+			{
+				TestTrue(FString::Printf(TEXT("16-bit Float keeps its precision at %.0f dBFS (%.1f dB SNR)"), LevelDb, SnrDb), SnrDb > 60.0);
+			}
+			else if (Formats[FormatIndex] == Audio::EDelayStorageFormat::Int16 && LevelDb >= -20.0f)
+			{
+				TestTrue(FString::Printf(TEXT("16-bit Integer is clean near full scale at %.0f dBFS (%.1f dB SNR)"), LevelDb, SnrDb), SnrDb > 60.0);
+			}
+		}
+		AddInfo(Report.LeftChop(1));
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "DattorroOfflineRender.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDattorroVelvetReverbCostTest, "Audio.DattorroReverb.Cost.VelvetAgainstDattorro",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FDattorroVelvetReverbCostTest::RunTest(const FString& Parameters)
+{
+	// 10 s of 48 kHz audio through each reverb at its node defaults, mono in and out
+	constexpr int32 NumBlocks = 1000;
+	constexpr float SampleRate = 48000.0f;
+
+	// One untimed pass each first, so both run with the delay pool and caches warm
+	Metasound::TimeReverberationBlocks(NumBlocks / 10, SampleRate);
+	Metasound::TimeVelvetReverbBlocks(NumBlocks / 10, SampleRate);
+
+	const double DattorroSeconds = Metasound::TimeReverberationBlocks(NumBlocks, SampleRate);
+	const double VelvetSeconds = Metasound::TimeVelvetReverbBlocks(NumBlocks, SampleRate);
+
+	AddInfo(FString::Printf(TEXT("Dattorro: %.2f us per 480 frame block"), 1.0e6 * DattorroSeconds / NumBlocks));
+	AddInfo(FString::Printf(TEXT("Velvet: %.2f us per 480 frame block (%.2fx the Dattorro cost)"), 1.0e6 * VelvetSeconds / NumBlocks, VelvetSeconds / FMath::Max(DattorroSeconds, UE_DOUBLE_SMALL_NUMBER)));
+
+	TestTrue(TEXT("Both reverbs ran"), DattorroSeconds > 0.0 && VelvetSeconds > 0.0);
+	return true;
+}
+
+#endif
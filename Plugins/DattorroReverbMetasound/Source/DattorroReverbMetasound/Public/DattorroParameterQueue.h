@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+
+namespace Audio
+{
+	// The reverb inputs game code can set through a parameter queue.
+	enum class EDattorroQueuedParameter : uint8
+	{
+		WetValue,
+		DryValue,
+		DecayRate,
+		DelayDamping,
+		DecayTimeLow,
+		DecayTimeMid,
+		DecayTimeHigh,
+		ShimmerAmount,
+		EarlyReflectionsLevel,
+		Num
+	};
+
+	// One parameter change for one reverb instance.
+	struct FDattorroParameterRecord
+	{
+		// Instance ID pin of the reverb node the change is for
+		int32 InstanceId = 0;
+
+		EDattorroQueuedParameter Parameter = EDattorroQueuedParameter::WetValue;
+		float Value = 0.0f;
+
+		// Frame of the next rendered block the change lands on. Offsets past the block carry over into the blocks after it.
+		int32 SampleOffset = 0;
+	};
+
+	/// Summary
+	///
+	/// Single producer, single consumer ring of parameter records for one reverb instance.
+	/// The producer (game code, on one thread) pushes; the reverb operator with the matching Instance ID pops at the start of
+	/// every block and applies each record on its sample offset. Fixed capacity, no locks and no allocation after construction.
+	///
+	/// Summary
+	class DATTORROREVERBMETASOUND_API FDattorroParameterQueue
+	{
+	public:
+		// Records in flight at most - a power of two
+		static constexpr uint32 Capacity = 256;
+
+		// Producer side. False, dropping the record, if the queue is full.
+		bool Push(const FDattorroParameterRecord& InRecord);
+
+		// Consumer side. False if the queue is empty.
+		bool Pop(FDattorroParameterRecord& OutRecord);
+
+		// Claims the consumer side for one reverb operator. Records already in the ring are kept for it - they are the values
+		// pushed before it was built, or while it waited for the last operator to go. False if another operator holds it.
+		// Lock free, so a waiting operator can retry every block.
+		bool TryClaimConsumer();
+
+		// Gives the consumer side back, for the next operator built with the same ID.
+		void ReleaseConsumer();
+
+	private:
+		FDattorroParameterRecord Records[Capacity];
+
+		// Free running indices - the slot is the index modulo Capacity
+		std::atomic<uint32> WriteIndex{ 0 };
+		std::atomic<uint32> ReadIndex{ 0 };
+
+		// Set while a reverb operator is draining this queue - a queue has one consumer
+		std::atomic<bool> bConsumerClaimed{ false };
+	};
+
+	/// Summary
+	///
+	/// Plugin-wide table of parameter queues, one per Instance ID.
+	/// Looking a queue up takes a lock, so producers look theirs up once and keep the handle; pushing through the handle is
+	/// lock free. Queues live as long as the table, so a handle stays good across the reverb being rebuilt.
+	///
+	///     TSharedRef<Audio::FDattorroParameterQueue> Queue = Audio::FDattorroParameterQueues::Get().FindOrAdd(ReverbId);
+	///     Queue->Push({ ReverbId, Audio::EDattorroQueuedParameter::WetValue, 1.0f, 0 });
+	///
+	/// Summary
+	class DATTORROREVERBMETASOUND_API FDattorroParameterQueues
+	{
+	public:
+		static FDattorroParameterQueues& Get();
+
+		// The queue for an Instance ID, made on first use.
+		TSharedRef<FDattorroParameterQueue, ESPMode::ThreadSafe> FindOrAdd(int32 InInstanceId);
+
+		// Pushes a record to the queue of its Instance ID. Takes the table lock - prefer keeping the queue from FindOrAdd.
+		bool Push(const FDattorroParameterRecord& InRecord);
+
+		// Claims the consumer side of a queue for a reverb operator. Null if another operator already drains that ID.
+		TSharedPtr<FDattorroParameterQueue, ESPMode::ThreadSafe> ClaimConsumer(int32 InInstanceId);
+
+		// Gives a claimed queue back, for the next operator built with its ID.
+		void ReleaseConsumer(FDattorroParameterQueue& InQueue);
+
+	private:
+		FDattorroParameterQueues() = default;
+
+		FCriticalSection QueuesCritSec;
+		TMap<int32, TSharedRef<FDattorroParameterQueue, ESPMode::ThreadSafe>> Queues;
+	};
+}
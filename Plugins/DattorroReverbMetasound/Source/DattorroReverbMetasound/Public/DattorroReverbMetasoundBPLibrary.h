@@ -5,7 +5,156 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "DattorroReverbMetasoundBPLibrary.generated.h"
 
-/* 
+class USoundWave;
+
+// Early reflection room for an offline render. Mirrors the node's Early Reflections pin.
+UENUM(BlueprintType)
+enum class EDattorroRenderEarlyReflections : uint8
+{
+	Off,
+	SmallRoom,
+	MediumRoom,
+	LargeHall,
+	Corridor
+};
+
+/**
+ * The reverb node's pins for an offline render, with the node's defaults and units.
+ * Triggers, Instance ID and Delay Storage have no meaning offline and are left out - renders always use 32-bit delays.
+ */
+USTRUCT(BlueprintType)
+struct DATTORROREVERBMETASOUND_API FDattorroReverbRenderSettings
+{
+	GENERATED_BODY()
+
+	/** Output channels - 1 (mono), 2 (stereo) or 4 (quad) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Output, meta=(ClampMin = "1", ClampMax = "4"))
+	int32 NumOutputChannels = 2;
+
+	/** Longest the tail may ring on past the end of the source, in s. The render stops sooner once the tail has died away. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Output, meta=(ClampMin = "0.0", ClampMax = "60.0"))
+	float MaxTailTime = 10.0f;
+
+	/** PreDelayTime, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input, meta=(ClampMin = "0.0", ClampMax = "1000.0"))
+	float PreDelayTime = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float PreLowPassFilterBandwidth = 1.0f;
+
+	/** Low Pass CutOff, in Hz */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input, meta=(ClampMin = "20.0", ClampMax = "20000.0"))
+	float LowPassCutOff = 500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input)
+	float AllPassCutoff = 0.4f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float InputDiffusion1 = 0.75f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Input, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float InputDiffusion2 = 0.625f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DecayRate = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DecayDiffusion1 = 0.7f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DecayDiffusion2 = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DelayDamping = 0.005f;
+
+	/** Random Delay, in samples */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "16.0"))
+	float RandomDelay = 16.0f;
+
+	/** Excursion Depth, in samples */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "32.0"))
+	float ExcursionDepth = 16.0f;
+
+	/** Excursion Rate, in Hz */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "10.0"))
+	float ExcursionRate = 1.0f;
+
+	/** Feedback Delay Left, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FeedbackDelayLeft = 80.0f;
+
+	/** Feedback Delay Right, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FeedbackDelayRight = 60.0f;
+
+	/** Final Delay Left, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FinalDelayLeft = 120.0f;
+
+	/** Final Delay Right, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tail, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FinalDelayRight = 100.0f;
+
+	/** Decay by the three Decay Times below in place of Decay Rate and Delay Damping */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay")
+	bool bThreeBandDecay = false;
+
+	/** Decay Time Low, in s */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay", meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeLow = 3.0f;
+
+	/** Decay Time Mid, in s */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay", meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeMid = 2.0f;
+
+	/** Decay Time High, in s */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay", meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeHigh = 0.8f;
+
+	/** Crossover Low, in Hz */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay", meta=(ClampMin = "20.0"))
+	float CrossoverLow = 250.0f;
+
+	/** Crossover High, in Hz */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Three Band Decay", meta=(ClampMin = "20.0"))
+	float CrossoverHigh = 4000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Early Reflections")
+	EDattorroRenderEarlyReflections EarlyReflections = EDattorroRenderEarlyReflections::Off;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Early Reflections", meta=(ClampMin = "0.5", ClampMax = "2.0"))
+	float RoomSize = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Early Reflections", meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float EarlyReflectionsLevel = 0.5f;
+
+	/** Mix the 14 output taps from the Dattorro paper in place of the original taps */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Output)
+	bool bDattorroOutputTaps = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Output, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float WetValue = 0.65f;
+
+	/** 0 renders the wet signal alone */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Output, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DryValue = 0.35f;
+
+	/** Render through the Shimmer Reverberation tank. Shimmer renders take mono sources only, like the shimmer nodes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Shimmer)
+	bool bWithShimmer = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Shimmer, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float ShimmerAmount = 0.3f;
+
+	/** Shimmer Pitch, in semitones */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Shimmer, meta=(ClampMin = "-24.0", ClampMax = "24.0"))
+	float ShimmerPitch = 12.0f;
+};
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnDattorroReverbPCMRendered, bool, bSuccess, const TArray<float>&, RenderedPCM);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnDattorroReverbSoundWaveRendered, USoundWave*, RenderedSoundWave);
+
+/*
 *	Function library class.
 *	Each function in it is expected to be static and represents blueprint node that can be called in any blueprint.
 *
@@ -15,7 +164,7 @@
 *	DisplayName - full name of the node, shown when you mouse over the node and in the blueprint drop down menu.
 *				Its lets you name the node using characters not allowed in C++ function names.
 *	CompactNodeTitle - the word(s) that appear on the node.
-*	Keywords -	the list of keywords that helps you to find node when you search for it using Blueprint drop-down menu. 
+*	Keywords -	the list of keywords that helps you to find node when you search for it using Blueprint drop-down menu.
 *				Good example is "Print String" node which you can find also by using keyword "log".
 *	Category -	the category your node will be under in the Blueprint drop-down menu.
 *
@@ -23,10 +172,30 @@
 *	https://wiki.unrealengine.com/Custom_Blueprint_Node_Creation
 */
 UCLASS()
-class UDattorroReverbMetasoundBPLibrary : public UBlueprintFunctionLibrary
+class DATTORROREVERBMETASOUND_API UDattorroReverbMetasoundBPLibrary : public UBlueprintFunctionLibrary
 {
 	GENERATED_UCLASS_BODY()
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Execute Sample function", Keywords = "DattorroReverbMetasound sample test testing"), Category = "DattorroReverbMetasoundTesting")
 	static float DattorroReverbMetasoundSampleFunction(float Param);
+
+	/**
+	 * Renders interleaved PCM through the reverb on a background task - the same operator the MetaSound node runs.
+	 * The source takes 1, 2, 4, 6 or 8 channels (1 for shimmer); the result has Settings.NumOutputChannels, runs on past the
+	 * source until the tail has died away (or MaxTailTime), and is handed to OnRendered on the game thread.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Render Dattorro Reverb (PCM)", Keywords = "reverb bake offline render"), Category = "Dattorro Reverb")
+	static void RenderReverbPCM(const TArray<float>& InterleavedPCM, int32 NumChannels, int32 SampleRate, const FDattorroReverbRenderSettings& Settings, FOnDattorroReverbPCMRendered OnRendered);
+
+	/**
+	 * Renders a sound wave's imported audio through the reverb on a background task and saves the result as a new sound wave
+	 * asset, PackagePath/AssetName. A render that peaks over full scale is normalized to 0 dBFS, with a warning, rather than
+	 * clipped. OnRendered gets the new asset on the game thread, or null if the render failed.
+	 * Editor only - packaged builds do not keep the imported audio.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Render Dattorro Reverb To Sound Wave", Keywords = "reverb bake offline render asset"), Category = "Dattorro Reverb")
+	static void RenderReverbToSoundWave(USoundWave* SourceWave, const FDattorroReverbRenderSettings& Settings, const FString& PackagePath, const FString& AssetName, FOnDattorroReverbSoundWaveRendered OnRendered);
+
+	/** Synchronous render for C++ callers (commandlets, import pipelines), on the calling thread. False if the channel counts are not supported. */
+	static bool RenderReverb(TConstArrayView<float> InInterleavedPCM, int32 InNumChannels, int32 InSampleRate, const FDattorroReverbRenderSettings& InSettings, TArray<float>& OutInterleavedPCM);
 };
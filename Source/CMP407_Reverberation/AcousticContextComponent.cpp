@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AcousticContextComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+UAcousticContextComponent::UAcousticContextComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// Prefetching only has to keep up with walking pace
+	PrimaryComponentTick.TickInterval = 0.1f;
+
+	TraceDelegate.BindUObject(this, &UAcousticContextComponent::OnGroundTraceDone);
+}
+
+void UAcousticContextComponent::RequestGround(TFunction<void(const FAcousticGroundInfo&)>&& OnGround)
+{
+	if (IsCacheCurrent())
+	{
+		OnGround(CachedGround);
+		return;
+	}
+
+	PendingRequests.Add(MoveTemp(OnGround));
+	QueryGround();
+
+	// The movement's floor may have answered straight away
+	if (!PendingTrace.IsValid())
+	{
+		TArray<TFunction<void(const FAcousticGroundInfo&)>> Requests = MoveTemp(PendingRequests);
+		for (TFunction<void(const FAcousticGroundInfo&)>& Request : Requests)
+		{
+			Request(CachedGround);
+		}
+	}
+}
+
+void UAcousticContextComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Prefetch on new ground, so the next step finds it cached
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	if (Character && Character->GetCharacterMovement()->IsMovingOnGround() && !IsCacheCurrent())
+	{
+		QueryGround();
+	}
+}
+
+FVector UAcousticContextComponent::GetFootLocation() const
+{
+	const AActor* Owner = GetOwner();
+	const ACharacter* Character = Cast<ACharacter>(Owner);
+	if (Character == nullptr)
+	{
+		return Owner->GetActorLocation();
+	}
+
+	const FFindFloorResult& Floor = Character->GetCharacterMovement()->CurrentFloor;
+	if (Floor.bBlockingHit)
+	{
+		return Floor.HitResult.ImpactPoint;
+	}
+	return Owner->GetActorLocation() - FVector(0.0f, 0.0f, Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+}
+
+bool UAcousticContextComponent::IsCacheCurrent() const
+{
+	if (!CachedGround.bValid)
+	{
+		return false;
+	}
+
+	const AActor* Owner = GetOwner();
+	if (FVector::DistSquared(Owner->GetActorLocation(), CachedGround.QueryLocation) > FMath::Square(RefreshDistance))
+	{
+		return false;
+	}
+
+	// Off the ground (or onto another component) the cache no longer holds
+	const ACharacter* Character = Cast<ACharacter>(Owner);
+	if (Character)
+	{
+		const FFindFloorResult& Floor = Character->GetCharacterMovement()->CurrentFloor;
+		return Floor.bBlockingHit && Floor.HitResult.GetComponent() == CachedGround.Component.Get();
+	}
+	return true;
+}
+
+void UAcousticContextComponent::QueryGround()
+{
+	if (PendingTrace.IsValid())
+	{
+		return;
+	}
+
+	const AActor* Owner = GetOwner();
+	const FVector Start = Owner->GetActorLocation();
+
+	// The movement component has already swept for the floor - reuse its hit when it carries a material
+	const ACharacter* Character = Cast<ACharacter>(Owner);
+	if (Character)
+	{
+		const FFindFloorResult& Floor = Character->GetCharacterMovement()->CurrentFloor;
+		if (Floor.bBlockingHit && Floor.HitResult.PhysMaterial.IsValid())
+		{
+			StoreGround(Floor.HitResult, Start);
+			return;
+		}
+	}
+
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	if (Character)
+	{
+		Character->GetCapsuleComponent()->GetScaledCapsuleSize(Radius, HalfHeight);
+	}
+	const FVector End = Start - FVector(0.0f, 0.0f, HalfHeight * 2.0f);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(AcousticGround), false, Owner);
+	Params.bReturnPhysicalMaterial = true;
+
+	PendingTrace = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, ECC_Visibility,
+		FCollisionShape::MakeSphere(Radius), Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+}
+
+void UAcousticContextComponent::OnGroundTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Handle != PendingTrace)
+	{
+		return;
+	}
+	PendingTrace = FTraceHandle();
+
+	if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
+	{
+		StoreGround(Datum.OutHits[0], Datum.Start);
+	}
+	else
+	{
+		// Nothing below - answer with no ground, and query again next time
+		CachedGround = FAcousticGroundInfo();
+	}
+
+	TArray<TFunction<void(const FAcousticGroundInfo&)>> Requests = MoveTemp(PendingRequests);
+	for (TFunction<void(const FAcousticGroundInfo&)>& Request : Requests)
+	{
+		Request(CachedGround);
+	}
+}
+
+void UAcousticContextComponent::StoreGround(const FHitResult& Hit, const FVector& InQueryLocation)
+{
+	const EPhysicalSurface PreviousSurface = CachedGround.SurfaceType;
+
+	CachedGround.PhysMaterial = Hit.PhysMaterial.Get();
+	CachedGround.SurfaceType = UPhysicalMaterial::DetermineSurfaceType(Hit.PhysMaterial.Get());
+	CachedGround.Component = Hit.GetComponent();
+	CachedGround.QueryLocation = InQueryLocation;
+	CachedGround.bValid = true;
+
+	if (CachedGround.SurfaceType != PreviousSurface)
+	{
+		OnGroundSurfaceChanged.Broadcast(CachedGround);
+	}
+}
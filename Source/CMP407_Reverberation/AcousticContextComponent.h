@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "AcousticContextComponent.generated.h"
+
+class UPhysicalMaterial;
+class UPrimitiveComponent;
+
+/**
+ * What the character is standing on, as far as its sounds are concerned.
+ * Only the surface is cached - it holds for the whole ground component, while the hit point is behind the character after a step.
+ */
+USTRUCT(BlueprintType)
+struct FAcousticGroundInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category=Audio)
+	TEnumAsByte<EPhysicalSurface> SurfaceType = SurfaceType_Default;
+
+	UPROPERTY(BlueprintReadOnly, Category=Audio)
+	TObjectPtr<UPhysicalMaterial> PhysMaterial = nullptr;
+
+	/** The ground component the result is for */
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	/** Where the character was when the ground was queried */
+	FVector QueryLocation = FVector::ZeroVector;
+
+	bool bValid = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundSurfaceChanged, const FAcousticGroundInfo&, Ground);
+
+/**
+ * One cached ground query per character, shared by footsteps, landings and anything else that needs the surface.
+ * The character movement's current floor is reused when it already carries a physical material; otherwise the ground is
+ * found with an asynchronous sweep, so no physics query runs on the game thread's critical path. The component prefetches
+ * while the character moves onto new ground, so a step normally finds the answer cached; callers that arrive first are
+ * answered when the sweep completes (a frame later).
+ */
+UCLASS(Blueprintable, BlueprintType, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class CMP407_REVERBERATION_API UAcousticContextComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Moving further than this (cm) from the last query re-queries, even on the same ground component */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Audio)
+	float RefreshDistance = 150.0f;
+
+	/** Fired whenever the surface type under the character changes */
+	UPROPERTY(BlueprintAssignable, Category=Audio)
+	FOnGroundSurfaceChanged OnGroundSurfaceChanged;
+
+	UAcousticContextComponent();
+
+	/** Calls OnGround with the ground under the owner - now if the cache is current, otherwise when the async sweep is done */
+	void RequestGround(TFunction<void(const FAcousticGroundInfo&)>&& OnGround);
+
+	/** The last ground found, which may be a little stale */
+	UFUNCTION(BlueprintPure, Category=Audio)
+	const FAcousticGroundInfo& GetCachedGround() const { return CachedGround; }
+
+	/** Where the owner's feet are now - the movement's current floor if it has one, otherwise the bottom of the capsule */
+	UFUNCTION(BlueprintPure, Category=Audio)
+	FVector GetFootLocation() const;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	/** True if the cache still describes the ground the owner stands on */
+	bool IsCacheCurrent() const;
+
+	/** Takes the movement's floor if it has a material, otherwise starts a sweep (one at a time) */
+	void QueryGround();
+
+	void OnGroundTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	void StoreGround(const FHitResult& Hit, const FVector& InQueryLocation);
+
+	FAcousticGroundInfo CachedGround;
+
+	FTraceHandle PendingTrace;
+	FTraceDelegate TraceDelegate;
+
+	/** Requests waiting on the pending sweep */
+	TArray<TFunction<void(const FAcousticGroundInfo&)>> PendingRequests;
+};
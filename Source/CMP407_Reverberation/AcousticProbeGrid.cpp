@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AcousticProbeGrid.h"
+#include "ReverbZoneVolume.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace AcousticProbes
+{
+	constexpr float MinDecayTime = 0.05f;
+	constexpr float MaxDecayTime = 60.0f;
+	// Matches the longest pre-delay the reverb node applies with the graph's default PreDelayTime
+	constexpr float MaxPreDelay = 50.0f;
+	constexpr float MaxCode = 255.0f;
+
+	uint8 QuantizeDecayTime(float Seconds)
+	{
+		const float Position = FMath::Loge(FMath::Clamp(Seconds, MinDecayTime, MaxDecayTime) / MinDecayTime) / FMath::Loge(MaxDecayTime / MinDecayTime);
+		return static_cast<uint8>(FMath::RoundToInt(Position * MaxCode));
+	}
+
+	float DequantizeDecayTime(float Code)
+	{
+		return MinDecayTime * FMath::Pow(MaxDecayTime / MinDecayTime, Code / MaxCode);
+	}
+
+	uint8 QuantizeDecayRate(float DecayRate)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(DecayRate, 0.0f, 1.0f) * MaxCode));
+	}
+
+	float DequantizeDecayRate(float Code)
+	{
+		return Code / MaxCode;
+	}
+
+	uint8 QuantizePreDelay(float Milliseconds)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Milliseconds, 0.0f, MaxPreDelay) / MaxPreDelay * MaxCode));
+	}
+
+	float DequantizePreDelay(float Code)
+	{
+		return Code / MaxCode * MaxPreDelay;
+	}
+
+	bool SaveGrid(const FString& Filename, const FAcousticProbeGridHeader& Header, TConstArrayView<FAcousticProbeRecord> Records)
+	{
+		check(Records.Num() == Header.CountX * Header.CountY * Header.CountZ);
+
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(sizeof(FAcousticProbeGridHeader) + Records.Num() * sizeof(FAcousticProbeRecord));
+		FMemory::Memcpy(Data.GetData(), &Header, sizeof(FAcousticProbeGridHeader));
+		FMemory::Memcpy(Data.GetData() + sizeof(FAcousticProbeGridHeader), Records.GetData(), Records.Num() * sizeof(FAcousticProbeRecord));
+
+		return FFileHelper::SaveArrayToFile(Data, *Filename);
+	}
+
+	FString GetGridFilename(const FString& MapName)
+	{
+		return FPaths::ProjectContentDir() / TEXT("AcousticProbes") / (FPaths::GetBaseFilename(MapName) + TEXT(".apg"));
+	}
+}
+
+FAcousticProbeGrid::FAcousticProbeGrid()
+{
+}
+
+FAcousticProbeGrid::~FAcousticProbeGrid()
+{
+	Unload();
+}
+
+bool FAcousticProbeGrid::Load(const FString& Filename)
+{
+	Unload();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		return false;
+	}
+
+	FOpenMappedResult MapResult = PlatformFile.OpenMappedEx(*Filename);
+	if (MapResult.HasValue())
+	{
+		MappedFile = MapResult.StealValue();
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		if (MappedRegion.IsValid() && SetData(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()))
+		{
+			return true;
+		}
+		Unload();
+	}
+
+	if (FFileHelper::LoadFileToArray(LoadedData, *Filename) && SetData(LoadedData.GetData(), LoadedData.Num()))
+	{
+		return true;
+	}
+
+	Unload();
+	return false;
+}
+
+void FAcousticProbeGrid::Unload()
+{
+	Records = nullptr;
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedData.Empty();
+}
+
+bool FAcousticProbeGrid::SetData(const uint8* Data, int64 Size)
+{
+	if (Data == nullptr || Size < static_cast<int64>(sizeof(FAcousticProbeGridHeader)))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&Header, Data, sizeof(FAcousticProbeGridHeader));
+	if (Header.Magic != FAcousticProbeGridHeader::FileMagic || Header.Version != FAcousticProbeGridHeader::FileVersion
+		|| Header.RecordSize != sizeof(FAcousticProbeRecord) || Header.CountX <= 0 || Header.CountY <= 0 || Header.CountZ <= 0
+		|| Header.Spacing <= 0.0f)
+	{
+		return false;
+	}
+
+	const int64 NumRecords = static_cast<int64>(Header.CountX) * Header.CountY * Header.CountZ;
+	if (Size < static_cast<int64>(sizeof(FAcousticProbeGridHeader)) + NumRecords * static_cast<int64>(sizeof(FAcousticProbeRecord)))
+	{
+		return false;
+	}
+
+	Records = reinterpret_cast<const FAcousticProbeRecord*>(Data + sizeof(FAcousticProbeGridHeader));
+	return true;
+}
+
+bool FAcousticProbeGrid::Sample(const FVector& Location, FReverbZonePreset& InOutPreset) const
+{
+	if (Records == nullptr)
+	{
+		return false;
+	}
+
+	// Position in probe units
+	const float LocalX = (Location.X - Header.OriginX) / Header.Spacing;
+	const float LocalY = (Location.Y - Header.OriginY) / Header.Spacing;
+	const float LocalZ = (Location.Z - Header.OriginZ) / Header.Spacing;
+	if (LocalX < 0.0f || LocalY < 0.0f || LocalZ < 0.0f || LocalX > Header.CountX - 1 || LocalY > Header.CountY - 1 || LocalZ > Header.CountZ - 1)
+	{
+		return false;
+	}
+
+	const int32 X0 = FMath::Min(FMath::FloorToInt(LocalX), Header.CountX - 1);
+	const int32 Y0 = FMath::Min(FMath::FloorToInt(LocalY), Header.CountY - 1);
+	const int32 Z0 = FMath::Min(FMath::FloorToInt(LocalZ), Header.CountZ - 1);
+	const int32 X1 = FMath::Min(X0 + 1, Header.CountX - 1);
+	const int32 Y1 = FMath::Min(Y0 + 1, Header.CountY - 1);
+	const int32 Z1 = FMath::Min(Z0 + 1, Header.CountZ - 1);
+	const float FracX = LocalX - X0;
+	const float FracY = LocalY - Y0;
+	const float FracZ = LocalZ - Z0;
+
+	float TotalWeight = 0.0f;
+	float DecayTimeLow = 0.0f;
+	float DecayTimeMid = 0.0f;
+	float DecayTimeHigh = 0.0f;
+	float DecayRate = 0.0f;
+	float PreDelayTime = 0.0f;
+
+	for (int32 Corner = 0; Corner < 8; Corner++)
+	{
+		const int32 X = (Corner & 1) ? X1 : X0;
+		const int32 Y = (Corner & 2) ? Y1 : Y0;
+		const int32 Z = (Corner & 4) ? Z1 : Z0;
+		const FAcousticProbeRecord& Record = Records[(static_cast<int64>(Z) * Header.CountY + Y) * Header.CountX + X];
+		if (Record.Flags & FAcousticProbeRecord::Flag_Blocked)
+		{
+			continue;
+		}
+
+		const float Weight = ((Corner & 1) ? FracX : 1.0f - FracX) * ((Corner & 2) ? FracY : 1.0f - FracY) * ((Corner & 4) ? FracZ : 1.0f - FracZ);
+		TotalWeight += Weight;
+		DecayTimeLow += Weight * Record.DecayTimeLow;
+		DecayTimeMid += Weight * Record.DecayTimeMid;
+		DecayTimeHigh += Weight * Record.DecayTimeHigh;
+		DecayRate += Weight * Record.DecayRate;
+		PreDelayTime += Weight * Record.PreDelayTime;
+	}
+
+	if (TotalWeight <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// Blending the codes blends the decay times on their log scale
+	const float InvWeight = 1.0f / TotalWeight;
+	InOutPreset.DecayTimeLow = AcousticProbes::DequantizeDecayTime(DecayTimeLow * InvWeight);
+	InOutPreset.DecayTimeMid = AcousticProbes::DequantizeDecayTime(DecayTimeMid * InvWeight);
+	InOutPreset.DecayTimeHigh = AcousticProbes::DequantizeDecayTime(DecayTimeHigh * InvWeight);
+	InOutPreset.DecayRate = AcousticProbes::DequantizeDecayRate(DecayRate * InvWeight);
+	InOutPreset.PreDelayTime = AcousticProbes::DequantizePreDelay(PreDelayTime * InvWeight);
+	return true;
+}
@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FReverbZonePreset;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Baked acoustic probe grid file (.apg), written by the BakeAcousticProbes commandlet.
+ * Little endian: one FAcousticProbeGridHeader, then CountX * CountY * CountZ records, X fastest. The header is 48 bytes and
+ * records 8, so the file can be memory mapped and read in place.
+ */
+struct FAcousticProbeGridHeader
+{
+	static constexpr uint32 FileMagic = 0x52475041; // "APGR"
+	static constexpr uint32 FileVersion = 2;
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	int32 CountX = 0;
+	int32 CountY = 0;
+	int32 CountZ = 0;
+
+	/** World position (cm) of probe (0, 0, 0) */
+	float OriginX = 0.0f;
+	float OriginY = 0.0f;
+	float OriginZ = 0.0f;
+
+	/** Distance (cm) between neighbouring probes */
+	float Spacing = 0.0f;
+
+	uint32 RecordSize = 0;
+	uint32 Reserved[2] = { 0, 0 };
+};
+static_assert(sizeof(FAcousticProbeGridHeader) == 48, "The probe grid header is a file format");
+
+/** One probe - the reverb node parameters it drives, quantized to a byte each */
+struct FAcousticProbeRecord
+{
+	enum EFlags : uint8
+	{
+		// The probe sits inside geometry - it has no room and gets no weight
+		Flag_Blocked = 1 << 0,
+	};
+
+	/** Decay times, log scale over the node's 0.05 to 60 s */
+	uint8 DecayTimeLow = 0;
+	uint8 DecayTimeMid = 0;
+	uint8 DecayTimeHigh = 0;
+
+	/** Decay Rate, 0 to 1 */
+	uint8 DecayRate = 0;
+
+	/** PreDelayTime, 0 to 50 ms */
+	uint8 PreDelayTime = 0;
+
+	uint8 Flags = 0;
+	uint8 Padding[2] = { 0, 0 };
+};
+static_assert(sizeof(FAcousticProbeRecord) == 8, "The probe record is a file format");
+
+namespace AcousticProbes
+{
+	CMP407_REVERBERATION_API uint8 QuantizeDecayTime(float Seconds);
+	CMP407_REVERBERATION_API float DequantizeDecayTime(float Code);
+
+	CMP407_REVERBERATION_API uint8 QuantizeDecayRate(float DecayRate);
+	CMP407_REVERBERATION_API float DequantizeDecayRate(float Code);
+
+	CMP407_REVERBERATION_API uint8 QuantizePreDelay(float Milliseconds);
+	CMP407_REVERBERATION_API float DequantizePreDelay(float Code);
+
+	/** Writes a grid file, header then records */
+	CMP407_REVERBERATION_API bool SaveGrid(const FString& Filename, const FAcousticProbeGridHeader& Header, TConstArrayView<FAcousticProbeRecord> Records);
+
+	/** Where the grid for a map is baked to and looked for - Content/AcousticProbes/<Map>.apg, packaged as a non-asset directory */
+	CMP407_REVERBERATION_API FString GetGridFilename(const FString& MapName);
+}
+
+/**
+ * A loaded probe grid. The file is memory mapped where the platform can, and read into memory otherwise.
+ * Sample is a trilinear fetch of the eight probes around a point - no physics queries.
+ */
+class CMP407_REVERBERATION_API FAcousticProbeGrid
+{
+public:
+	FAcousticProbeGrid();
+	~FAcousticProbeGrid();
+
+	FAcousticProbeGrid(const FAcousticProbeGrid&) = delete;
+	FAcousticProbeGrid& operator=(const FAcousticProbeGrid&) = delete;
+
+	/** Maps (or loads) a grid file and checks its header. False if it is missing or not a grid of this version. */
+	bool Load(const FString& Filename);
+
+	void Unload();
+
+	bool IsLoaded() const { return Records != nullptr; }
+
+	/**
+	 * Writes the baked parameters at Location into InOutPreset, blended from the surrounding probes.
+	 * Blocked probes are left out of the blend. False, leaving the preset alone, outside the grid or among blocked probes only.
+	 */
+	bool Sample(const FVector& Location, FReverbZonePreset& InOutPreset) const;
+
+private:
+	bool SetData(const uint8* Data, int64 Size);
+
+	FAcousticProbeGridHeader Header;
+	const FAcousticProbeRecord* Records = nullptr;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Used where mapping is not supported */
+	TArray<uint8> LoadedData;
+};
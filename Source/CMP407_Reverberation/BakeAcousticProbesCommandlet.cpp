@@ -0,0 +1,167 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BakeAcousticProbesCommandlet.h"
+#include "AcousticProbeGrid.h"
+#include "RoomAcousticsSubsystem.h"
+#include "ReverbZoneVolume.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/World.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAcousticProbes, Log, All);
+
+UBakeAcousticProbesCommandlet::UBakeAcousticProbesCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UBakeAcousticProbesCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogAcousticProbes, Error, TEXT("No map given - pass -Map=/Game/Path/To/Level"));
+		return 1;
+	}
+
+	float Spacing = 400.0f;
+	int32 NumRays = 128;
+	float RayLength = 5000.0f;
+	float SurfaceAbsorption = 0.1f;
+	float LowDecayRatio = 1.3f;
+	float HighDecayRatio = 0.5f;
+	int32 MaxProbes = 2000000;
+	FString OutputFilename = AcousticProbes::GetGridFilename(MapName);
+	FParse::Value(*Params, TEXT("Spacing="), Spacing);
+	FParse::Value(*Params, TEXT("Rays="), NumRays);
+	FParse::Value(*Params, TEXT("RayLength="), RayLength);
+	FParse::Value(*Params, TEXT("Absorption="), SurfaceAbsorption);
+	FParse::Value(*Params, TEXT("LowDecayRatio="), LowDecayRatio);
+	FParse::Value(*Params, TEXT("HighDecayRatio="), HighDecayRatio);
+	FParse::Value(*Params, TEXT("MaxProbes="), MaxProbes);
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+	Spacing = FMath::Max(Spacing, 10.0f);
+	NumRays = FMath::Clamp(NumRays, 8, 1024);
+
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogAcousticProbes, Error, TEXT("Could not load map %s"), *MapName);
+		return 1;
+	}
+
+	// Bring the level up far enough to trace against
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+	World->InitWorld(UWorld::InitializationValues()
+		.AllowAudioPlayback(false)
+		.CreatePhysicsScene(true)
+		.RequiresHitProxies(false)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.ShouldSimulatePhysics(false)
+		.SetTransactional(false));
+	World->UpdateWorldComponents(true, false);
+
+	const FBox Bounds = ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+
+	FAcousticProbeGridHeader Header;
+	Header.CountX = FMath::Max(FMath::CeilToInt(Bounds.GetSize().X / Spacing), 0) + 1;
+	Header.CountY = FMath::Max(FMath::CeilToInt(Bounds.GetSize().Y / Spacing), 0) + 1;
+	Header.CountZ = FMath::Max(FMath::CeilToInt(Bounds.GetSize().Z / Spacing), 0) + 1;
+	Header.OriginX = Bounds.Min.X;
+	Header.OriginY = Bounds.Min.Y;
+	Header.OriginZ = Bounds.Min.Z;
+	Header.Spacing = Spacing;
+	Header.RecordSize = sizeof(FAcousticProbeRecord);
+
+	const int64 NumProbes = static_cast<int64>(Header.CountX) * Header.CountY * Header.CountZ;
+	int32 Result = 0;
+
+	if (!Bounds.IsValid || NumProbes > MaxProbes)
+	{
+		UE_LOG(LogAcousticProbes, Error, TEXT("%s needs %lld probes at %.0f cm spacing - more than MaxProbes (%d). Raise -Spacing or -MaxProbes."),
+			*MapName, NumProbes, Spacing, MaxProbes);
+		Result = 1;
+	}
+	else
+	{
+		UE_LOG(LogAcousticProbes, Display, TEXT("Baking %d x %d x %d probes (%d rays each) for %s"), Header.CountX, Header.CountY, Header.CountZ, NumRays, *MapName);
+
+		TArray<FVector> RayDirections;
+		URoomAcousticsSubsystem::MakeRayDirections(NumRays, RayDirections);
+
+		TArray<FAcousticProbeRecord> Records;
+		Records.SetNum(static_cast<int32>(NumProbes));
+
+		// The preset the decay rate is worked out against - the node's defaults
+		const FReverbZonePreset BasePreset;
+
+		ParallelFor(static_cast<int32>(NumProbes), [&](int32 ProbeIndex)
+		{
+			const int32 X = ProbeIndex % Header.CountX;
+			const int32 Y = (ProbeIndex / Header.CountX) % Header.CountY;
+			const int32 Z = ProbeIndex / (Header.CountX * Header.CountY);
+			const FVector Location = Bounds.Min + FVector(X, Y, Z) * Spacing;
+
+			FAcousticProbeRecord& Record = Records[ProbeIndex];
+
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AcousticProbeBake), false);
+			if (World->OverlapBlockingTestByChannel(Location, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(10.0f), QueryParams))
+			{
+				Record.Flags = FAcousticProbeRecord::Flag_Blocked;
+				return;
+			}
+
+			TArray<float, TInlineAllocator<128>> RayDistances;
+			TArray<bool, TInlineAllocator<128>> RayHits;
+			RayDistances.SetNumUninitialized(NumRays);
+			RayHits.SetNumUninitialized(NumRays);
+
+			for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+			{
+				FHitResult Hit;
+				RayHits[RayIndex] = World->LineTraceSingleByChannel(Hit, Location, Location + RayDirections[RayIndex] * RayLength, ECC_Visibility, QueryParams);
+				RayDistances[RayIndex] = RayHits[RayIndex] ? Hit.Distance : RayLength;
+			}
+
+			FReverbZonePreset Preset = BasePreset;
+			URoomAcousticsSubsystem::ApplyEstimate(URoomAcousticsSubsystem::EstimateRoom(RayDistances, RayHits, SurfaceAbsorption), LowDecayRatio, HighDecayRatio, Preset);
+
+			Record.DecayTimeLow = AcousticProbes::QuantizeDecayTime(Preset.DecayTimeLow);
+			Record.DecayTimeMid = AcousticProbes::QuantizeDecayTime(Preset.DecayTimeMid);
+			Record.DecayTimeHigh = AcousticProbes::QuantizeDecayTime(Preset.DecayTimeHigh);
+			Record.DecayRate = AcousticProbes::QuantizeDecayRate(Preset.DecayRate);
+			Record.PreDelayTime = AcousticProbes::QuantizePreDelay(Preset.PreDelayTime);
+		});
+
+		if (AcousticProbes::SaveGrid(OutputFilename, Header, Records))
+		{
+			UE_LOG(LogAcousticProbes, Display, TEXT("Wrote %s (%lld bytes)"), *OutputFilename, static_cast<int64>(sizeof(FAcousticProbeGridHeader) + NumProbes * sizeof(FAcousticProbeRecord)));
+		}
+		else
+		{
+			UE_LOG(LogAcousticProbes, Error, TEXT("Could not write %s"), *OutputFilename);
+			Result = 1;
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+
+	return Result;
+#else
+	UE_LOG(LogAcousticProbes, Error, TEXT("Acoustic probes can only be baked from the editor"));
+	return 1;
+#endif
+}
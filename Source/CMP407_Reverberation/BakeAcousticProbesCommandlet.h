@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BakeAcousticProbesCommandlet.generated.h"
+
+/**
+ * Bakes a level's room acoustics into a probe grid the room acoustics subsystem reads instead of tracing at runtime.
+ * Probes are laid out over the level bounds; each one measures its room with the same fan of traces and Sabine estimate as
+ * the runtime subsystem (the probes run in parallel), and is quantized to the reverb node parameters it drives.
+ *
+ * UnrealEditor-Cmd <Project> -run=BakeAcousticProbes -Map=/Game/Maps/Level [-Spacing=400] [-Rays=128] [-RayLength=5000]
+ *     [-Absorption=0.1] [-LowDecayRatio=1.3] [-HighDecayRatio=0.5] [-MaxProbes=2000000] [-Output=<file>]
+ *
+ * The grid is written to Content/AcousticProbes/<Map>.apg unless Output says otherwise. Add that directory to the
+ * project's non-asset directories to package.
+ */
+UCLASS()
+class CMP407_REVERBERATION_API UBakeAcousticProbesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBakeAcousticProbesCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
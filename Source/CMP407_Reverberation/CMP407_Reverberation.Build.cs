@@ -9,6 +9,6 @@ public class CMP407_Reverberation : ModuleRules
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "MetasoundGraphCore", "MetasoundEngine",
-			"MetasoundFrontend", "MetasoundStandardNodes", "SignalProcessing"  });
+			"MetasoundFrontend", "MetasoundStandardNodes", "SignalProcessing", "PhysicsCore", "AudioExtensions"  });
 	}
 }
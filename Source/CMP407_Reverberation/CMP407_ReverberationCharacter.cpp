@@ -2,6 +2,8 @@
 
 #include "CMP407_ReverberationCharacter.h"
 #include "CMP407_ReverberationProjectile.h"
+#include "AcousticContextComponent.h"
+#include "FootstepVoiceManagerComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -53,6 +55,12 @@ ACMP407_ReverberationCharacter::ACMP407_ReverberationCharacter()
 
 	GetCharacterMovement()->MaxWalkSpeed = 150.f;
 
+	// Steps and landings reuse a few voices per sound instead of spawning a new one each time
+	FootstepVoices = CreateDefaultSubobject<UFootstepVoiceManagerComponent>(TEXT("Footstep Voices"));
+
+	// One cached, asynchronous ground query shared by steps and landings
+	AcousticContext = CreateDefaultSubobject<UAcousticContextComponent>(TEXT("Acoustic Context"));
+
 	WalkSounds_Planet = CreateDefaultSubobject<USoundBase>(TEXT("Planet WalkSounds"));
 	WalkSounds_Ship = CreateDefaultSubobject<USoundBase>(TEXT("Ship WalkSounds"));
 
@@ -71,6 +79,12 @@ void ACMP407_ReverberationCharacter::BeginPlay()
 	// Call the base class  
 	Super::BeginPlay();
 
+	// Build every footstep and landing voice up front, so no step builds a graph
+	for (USoundBase* Sound : { WalkSounds_Ship, WalkSounds_Planet, RunSounds_Ship, RunSounds_Planet, LandSounds_Ship, LandSounds_Planet })
+	{
+		FootstepVoices->RegisterSound(Sound);
+	}
+
 	
 	if (WalkCurveFloat)
 	{
@@ -105,25 +119,22 @@ void ACMP407_ReverberationCharacter::Tick(float DeltaTime)
 
 void ACMP407_ReverberationCharacter::TryFootstep()
 {
-	GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("Try Step"));
-	
-	const FVector Start = GetActorLocation();
-	FVector End = Start + (FVector(0,0,-GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
-	float radius = GetCapsuleComponent()->GetScaledCapsuleRadius();
-
-	FHitResult Outhit;
-	FCollisionQueryParams Params;
-	Params.bReturnPhysicalMaterial = true;
-
-	if(GetWorld()->SweepSingleByChannel(Outhit, Start, End, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(radius), Params))
+	AcousticContext->RequestGround([this](const FAcousticGroundInfo& Ground)
 	{
-		switch (Outhit.PhysMaterial->SurfaceType)
+		if (!Ground.bValid)
+		{
+			return;
+		}
+
+		// The surface may be cached from further back - the step plays where the feet are now
+		const FVector FootLocation = AcousticContext->GetFootLocation();
+		switch (Ground.SurfaceType)
 		{
 		case EPhysicalSurface::SurfaceType1: // Metal
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), WalkSounds_Ship, Outhit.Location, 1, 1);
+			FootstepVoices->PlaySoundAt(WalkSounds_Ship, FootLocation);
 			break;
 		case EPhysicalSurface::SurfaceType2: // Planet
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), WalkSounds_Planet, Outhit.Location, 1, 1);
+			FootstepVoices->PlaySoundAt(WalkSounds_Planet, FootLocation);
 			break;
 		default:
             				
@@ -131,41 +142,36 @@ void ACMP407_ReverberationCharacter::TryFootstep()
 		}
 
 		//WalkTimeline.Stop();
-	}
+	});
 }
 
 void ACMP407_ReverberationCharacter::Landed(const FHitResult& Hit)
 {
 	Super::Landed(Hit);
 
-	const FVector Start = GetActorLocation();
-	FVector End = Start + (FVector(0,0,-GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 2));
-	float radius = GetCapsuleComponent()->GetScaledCapsuleRadius();
-
-	FHitResult Outhit;
-	FCollisionQueryParams Params;
-	Params.bReturnPhysicalMaterial = true;
-
-	if(GetWorld()->SweepSingleByChannel(Outhit, Start, End, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(radius), Params))
+	const FVector LandLocation = Hit.ImpactPoint;
+	AcousticContext->RequestGround([this, LandLocation](const FAcousticGroundInfo& Ground)
 	{
+		if (!Ground.bValid)
+		{
+			return;
+		}
+
 		OnLand.Broadcast();
 		
-		DrawDebugSphere(GetWorld(), Start, radius, 12, FColor::Orange, false, 5.0f);
-		DrawDebugSphere(GetWorld(), End, radius, 12, FColor::Red, false, 5.0f);
-		
-		switch (Outhit.PhysMaterial->SurfaceType)
+		switch (Ground.SurfaceType)
 		{
 		case EPhysicalSurface::SurfaceType1: // Metal
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), LandSounds_Ship, Outhit.Location, 1, 1);
+			FootstepVoices->PlaySoundAt(LandSounds_Ship, LandLocation);
 			break;
 		case EPhysicalSurface::SurfaceType2: // Planet
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), LandSounds_Planet, Outhit.Location, 1, 1);
+			FootstepVoices->PlaySoundAt(LandSounds_Planet, LandLocation);
 			break;
 		default:
 				
 			break;
 		}
-	}
+	});
 }
 
 //////////////////////////////////////////////////////////////////////////// Input
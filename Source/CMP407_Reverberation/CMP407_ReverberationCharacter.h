@@ -15,6 +15,9 @@ class UCameraComponent;
 class UInputAction;
 class UInputMappingContext;
 class UCurveFloat;
+class UFootstepVoiceManagerComponent;
+class UAcousticContextComponent;
+struct FAcousticGroundInfo;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -50,6 +53,14 @@ class ACMP407_ReverberationCharacter : public ACharacter
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Input, meta=(AllowPrivateAccess = "true"))
 	UInputAction* SprintAction;
 
+	/** Pooled voices for the footstep and landing sounds */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Audio, meta = (AllowPrivateAccess = "true"))
+	UFootstepVoiceManagerComponent* FootstepVoices;
+
+	/** Cached ground surface for the footstep and landing sounds */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Audio, meta = (AllowPrivateAccess = "true"))
+	UAcousticContextComponent* AcousticContext;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(AllowPrivateAccess = "true")) USoundBase* WalkSounds_Ship;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(AllowPrivateAccess = "true")) USoundBase* WalkSounds_Planet;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(AllowPrivateAccess = "true")) USoundBase* RunSounds_Planet;
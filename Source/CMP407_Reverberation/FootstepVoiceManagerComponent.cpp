@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FootstepVoiceManagerComponent.h"
+#include "ReverbZoneSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Sound/SoundBase.h"
+
+UFootstepVoiceManagerComponent::UFootstepVoiceManagerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UFootstepVoiceManagerComponent::RegisterSound(USoundBase* Sound)
+{
+	if (Sound == nullptr || FindRing(Sound) != nullptr)
+	{
+		return;
+	}
+
+	FFootstepVoiceRing& Ring = Rings.AddDefaulted_GetRef();
+	Ring.Sound = Sound;
+
+	TArray<FAudioParameter> DefaultParameters;
+	Sound->GetAllDefaultParameters(DefaultParameters);
+	Ring.bHasPlayTrigger = DefaultParameters.ContainsByPredicate([this](const FAudioParameter& Parameter)
+	{
+		return Parameter.ParamName == PlayTriggerName && Parameter.ParamType == EAudioParameterType::Trigger;
+	});
+
+	UReverbZoneSubsystem* ReverbZones = bFollowReverbZones ? GetWorld()->GetSubsystem<UReverbZoneSubsystem>() : nullptr;
+
+	for (int32 VoiceIndex = 0; VoiceIndex < FMath::Max(NumVoicesPerSound, 1); VoiceIndex++)
+	{
+		UAudioComponent* Voice = NewObject<UAudioComponent>(GetOwner());
+		Voice->bAutoActivate = false;
+		Voice->bAutoDestroy = false;
+		Voice->bStopWhenOwnerDestroyed = true;
+		Voice->SetUsingAbsoluteLocation(true);
+		Voice->SetSound(Sound);
+		Voice->RegisterComponent();
+
+		// Build the graph now so no step pays for it. It makes no sound until its trigger fires, so it can start at full
+		// volume. Anything else is left stopped - started now it would still be playing, and heard, on the first step.
+		if (Ring.bHasPlayTrigger)
+		{
+			Voice->Play();
+		}
+
+		if (ReverbZones != nullptr)
+		{
+			ReverbZones->RegisterReverbVoice(Voice);
+		}
+
+		Ring.Voices.Add(Voice);
+	}
+}
+
+void UFootstepVoiceManagerComponent::PlaySoundAt(USoundBase* Sound, const FVector& Location)
+{
+	if (Sound == nullptr)
+	{
+		return;
+	}
+
+	FFootstepVoiceRing* Ring = FindRing(Sound);
+	if (Ring == nullptr)
+	{
+		RegisterSound(Sound);
+		Ring = FindRing(Sound);
+	}
+
+	UAudioComponent* Voice = Ring->Voices[Ring->NextVoice];
+	Ring->NextVoice = (Ring->NextVoice + 1) % Ring->Voices.Num();
+
+	Voice->SetWorldLocation(Location);
+
+	if (Ring->bHasPlayTrigger && Voice->IsPlaying())
+	{
+		// Live graph - just fire the step
+		Voice->SetTriggerParameter(PlayTriggerName);
+	}
+	else
+	{
+		// No trigger to fire (or the graph has stopped) - restart the voice, cutting off whatever it was still playing
+		Voice->Stop();
+		Voice->Play();
+	}
+}
+
+void UFootstepVoiceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UReverbZoneSubsystem* ReverbZones = GetWorld()->GetSubsystem<UReverbZoneSubsystem>();
+
+	for (FFootstepVoiceRing& Ring : Rings)
+	{
+		for (UAudioComponent* Voice : Ring.Voices)
+		{
+			if (Voice != nullptr)
+			{
+				if (ReverbZones != nullptr)
+				{
+					ReverbZones->UnregisterReverbVoice(Voice);
+				}
+				Voice->Stop();
+				Voice->DestroyComponent();
+			}
+		}
+	}
+	Rings.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FFootstepVoiceRing* UFootstepVoiceManagerComponent::FindRing(const USoundBase* Sound)
+{
+	return Rings.FindByPredicate([Sound](const FFootstepVoiceRing& Ring) { return Ring.Sound == Sound; });
+}
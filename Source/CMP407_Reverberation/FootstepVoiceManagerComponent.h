@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "FootstepVoiceManagerComponent.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/** A ring of audio components that all play one sound */
+USTRUCT()
+struct FFootstepVoiceRing
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<USoundBase> Sound = nullptr;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> Voices;
+
+	/** Voice the next step takes - the oldest one */
+	int32 NextVoice = 0;
+
+	/** The sound is a MetaSound with the play trigger input, so its voices stay live between steps */
+	bool bHasPlayTrigger = false;
+};
+
+/**
+ * Plays footstep and landing sounds from a few pre-created audio components per sound instead of spawning one per step.
+ * Each voice starts its MetaSound once, then every later step only moves the voice to the hit location and fires the
+ * MetaSound's trigger input, so the graph is built once per voice rather than once per step.
+ * Sounds without the trigger input are not started ahead of time, and each step restarts the voice from the beginning;
+ * voices of trigger driven sounds that have stopped are restarted the same way.
+ */
+UCLASS(Blueprintable, BlueprintType, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class CMP407_REVERBERATION_API UFootstepVoiceManagerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Voices per sound - steps and landings overlapping by more than this steal the oldest voice */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Audio, meta=(ClampMin = "1", ClampMax = "16"))
+	int32 NumVoicesPerSound = 3;
+
+	/** MetaSound trigger input that plays one step */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Audio)
+	FName PlayTriggerName = TEXT("Play");
+
+	/** Lets the reverb zone subsystem drive the voices' reverb inputs - set before the sounds are registered */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Audio)
+	bool bFollowReverbZones = true;
+
+	UFootstepVoiceManagerComponent();
+
+	/** Creates the voices for a sound and, if it has the play trigger, starts their MetaSounds. Call once per sound, before play. */
+	UFUNCTION(BlueprintCallable, Category=Audio)
+	void RegisterSound(USoundBase* Sound);
+
+	/** Plays a sound at a location on its next voice, registering the sound first if needed */
+	UFUNCTION(BlueprintCallable, Category=Audio)
+	void PlaySoundAt(USoundBase* Sound, const FVector& Location);
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	FFootstepVoiceRing* FindRing(const USoundBase* Sound);
+
+	UPROPERTY()
+	TArray<FFootstepVoiceRing> Rings;
+};
@@ -0,0 +1,247 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ReverbZoneSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Components/BrushComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+namespace ReverbZones
+{
+	// Smallest change worth sending to the voices, relative to the size of each field
+	constexpr float PushTolerance = 1.0e-3f;
+
+	struct FWeightedVolume
+	{
+		const AReverbZoneVolume* Volume;
+		float Weight;
+	};
+
+	void FillParameterBatch(TArray<FAudioParameter>& Batch, const FReverbZonePreset& Preset)
+	{
+		const float Values[] =
+		{
+			Preset.PreDelayTime, Preset.DecayRate, Preset.DelayDamping, Preset.LowPassCutOff,
+			Preset.InputDiffusion1, Preset.InputDiffusion2, Preset.FinalDelayLeft, Preset.FinalDelayRight,
+			Preset.DecayTimeLow, Preset.DecayTimeMid, Preset.DecayTimeHigh, Preset.WetValue
+		};
+
+		// The names only need building once, after that only the values change
+		if (Batch.IsEmpty())
+		{
+			const TCHAR* Names[] =
+			{
+				TEXT("PreDelayTime"), TEXT("Decay Rate"), TEXT("Delay Damping"), TEXT("Low Pass CutOff"),
+				TEXT("Input Diffusion 1"), TEXT("Input Diffusion 2"), TEXT("Final Delay Left"), TEXT("Final Delay Right"),
+				TEXT("Decay Time Low"), TEXT("Decay Time Mid"), TEXT("Decay Time High"), TEXT("Wet Value")
+			};
+			static_assert(UE_ARRAY_COUNT(Names) == UE_ARRAY_COUNT(Values), "Every preset field needs a parameter name");
+
+			Batch.Reserve(UE_ARRAY_COUNT(Names));
+			for (const TCHAR* Name : Names)
+			{
+				Batch.Emplace(FName(Name), 0.0f);
+			}
+		}
+
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Values); ++Index)
+		{
+			Batch[Index].FloatParam = Values[Index];
+		}
+	}
+}
+
+void UReverbZoneSubsystem::RegisterVolume(AReverbZoneVolume* Volume)
+{
+	if (Volume != nullptr)
+	{
+		Volumes.AddUnique(Volume);
+		bGridDirty = true;
+	}
+}
+
+void UReverbZoneSubsystem::UnregisterVolume(AReverbZoneVolume* Volume)
+{
+	if (Volumes.Remove(Volume) > 0)
+	{
+		bGridDirty = true;
+	}
+}
+
+void UReverbZoneSubsystem::RegisterReverbVoice(UAudioComponent* Voice)
+{
+	if (Voice == nullptr || Voices.Contains(Voice))
+	{
+		return;
+	}
+
+	Voices.Add(Voice);
+
+	if (bHasPushed)
+	{
+		Voice->SetParameters(CopyTemp(ParameterBatch));
+	}
+}
+
+void UReverbZoneSubsystem::UnregisterReverbVoice(UAudioComponent* Voice)
+{
+	Voices.Remove(Voice);
+}
+
+bool UReverbZoneSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UReverbZoneSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bGridDirty)
+	{
+		RebuildGrid();
+	}
+
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController == nullptr)
+	{
+		return;
+	}
+
+	FVector ListenerLocation;
+	FVector FrontDir;
+	FVector RightDir;
+	PlayerController->GetAudioListenerPosition(ListenerLocation, FrontDir, RightDir);
+
+	const FReverbZonePreset TargetPreset = ComputePresetAt(ListenerLocation);
+	// Once within tolerance the ease snaps to the target, so the pushes stop instead of trailing the tail of the exponential
+	if (bHasPushed && !CurrentPreset.Equals(TargetPreset, ReverbZones::PushTolerance))
+	{
+		CurrentPreset.Lerp(CurrentPreset, TargetPreset, 1.0f - FMath::Exp(-BlendSpeed * DeltaTime));
+	}
+	else
+	{
+		CurrentPreset = TargetPreset;
+	}
+
+	if (!bHasPushed || !CurrentPreset.Equals(PushedPreset, ReverbZones::PushTolerance))
+	{
+		PushPreset();
+	}
+}
+
+TStatId UReverbZoneSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UReverbZoneSubsystem, STATGROUP_Tickables);
+}
+
+FIntVector UReverbZoneSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UReverbZoneSubsystem::RebuildGrid()
+{
+	Grid.Reset();
+	LargeVolumes.Reset();
+	Volumes.RemoveAll([](const TObjectPtr<AReverbZoneVolume>& Volume) { return Volume == nullptr; });
+
+	for (int32 VolumeIndex = 0; VolumeIndex < Volumes.Num(); VolumeIndex++)
+	{
+		const AReverbZoneVolume* Volume = Volumes[VolumeIndex];
+
+		// Index the whole reach of the volume, fade included
+		const FBox Reach = Volume->GetBrushComponent()->Bounds.GetBox().ExpandBy(Volume->BlendDistance);
+		const FIntVector MinCell = GetCell(Reach.Min);
+		const FIntVector MaxCell = GetCell(Reach.Max);
+		const FIntVector NumCells = MaxCell - MinCell + FIntVector(1);
+
+		if (static_cast<int64>(NumCells.X) * NumCells.Y * NumCells.Z > MaxCellsPerVolume)
+		{
+			LargeVolumes.Add(VolumeIndex);
+			continue;
+		}
+
+		for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+				{
+					Grid.FindOrAdd(FIntVector(X, Y, Z)).Add(VolumeIndex);
+				}
+			}
+		}
+	}
+
+	bGridDirty = false;
+}
+
+FReverbZonePreset UReverbZoneSubsystem::ComputePresetAt(const FVector& Location) const
+{
+	TArray<ReverbZones::FWeightedVolume, TInlineAllocator<8>> Weighted;
+
+	auto AddVolume = [this, &Location, &Weighted](int32 VolumeIndex)
+	{
+		const AReverbZoneVolume* Volume = Volumes[VolumeIndex];
+		const float Weight = Volume->GetWeightAt(Location);
+		if (Weight > 0.0f)
+		{
+			Weighted.Add({ Volume, Weight });
+		}
+	};
+
+	if (const TArray<int32>* Cell = Grid.Find(GetCell(Location)))
+	{
+		for (int32 VolumeIndex : *Cell)
+		{
+			AddVolume(VolumeIndex);
+		}
+	}
+	for (int32 VolumeIndex : LargeVolumes)
+	{
+		AddVolume(VolumeIndex);
+	}
+
+	// Highest priority first - each volume takes its weight of whatever the volumes above it left over.
+	// Equal priorities fall back to the actor name, so the blend doesn't depend on the order the volumes registered in.
+	Weighted.Sort([](const ReverbZones::FWeightedVolume& A, const ReverbZones::FWeightedVolume& B)
+	{
+		if (A.Volume->Priority != B.Volume->Priority)
+		{
+			return A.Volume->Priority > B.Volume->Priority;
+		}
+		return A.Volume->GetFName().LexicalLess(B.Volume->GetFName());
+	});
+
+	FReverbZonePreset Result;
+	FMemory::Memzero(Result);
+	float Remaining = 1.0f;
+
+	for (const ReverbZones::FWeightedVolume& Entry : Weighted)
+	{
+		Result.AddWeighted(Entry.Volume->Preset, Entry.Weight * Remaining);
+		Remaining *= 1.0f - Entry.Weight;
+	}
+	Result.AddWeighted(DefaultPreset, Remaining);
+
+	return Result;
+}
+
+void UReverbZoneSubsystem::PushPreset()
+{
+	ReverbZones::FillParameterBatch(ParameterBatch, CurrentPreset);
+
+	// Each voice takes ownership of the array it is given, so it gets a copy and the batch keeps its names for the next push
+	Voices.RemoveAll([](const TWeakObjectPtr<UAudioComponent>& Voice) { return !Voice.IsValid(); });
+	for (const TWeakObjectPtr<UAudioComponent>& Voice : Voices)
+	{
+		Voice->SetParameters(CopyTemp(ParameterBatch));
+	}
+
+	PushedPreset = CurrentPreset;
+	bHasPushed = true;
+}
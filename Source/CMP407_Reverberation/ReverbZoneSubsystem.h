@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AudioParameter.h"
+#include "ReverbZoneVolume.h"
+#include "ReverbZoneSubsystem.generated.h"
+
+class UAudioComponent;
+
+/**
+ * Maps the listener's position to reverb parameters.
+ * Reverb zone volumes are indexed in a uniform grid, so each tick only looks up the listener's cell and weighs the few volumes
+ * in it (volumes too big for the grid are kept in a short list checked every tick). Their presets are blended by priority
+ * over the default preset, eased in over time, and sent to every registered reverb voice as one batch of audio parameters
+ * per voice - and only when they have changed.
+ * Reverb voices are audio components playing a MetaSound whose graph inputs carry the reverb node's pin names.
+ */
+UCLASS()
+class CMP407_REVERBERATION_API UReverbZoneSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Preset heard outside every zone */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	FReverbZonePreset DefaultPreset;
+
+	/** How quickly (per second) the sent preset follows the listener's zone */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float BlendSpeed = 4.0f;
+
+	void RegisterVolume(AReverbZoneVolume* Volume);
+	void UnregisterVolume(AReverbZoneVolume* Volume);
+
+	/** Adds a voice to be driven by the zones. It is sent the current preset straight away. */
+	UFUNCTION(BlueprintCallable, Category=Reverb)
+	void RegisterReverbVoice(UAudioComponent* Voice);
+
+	UFUNCTION(BlueprintCallable, Category=Reverb)
+	void UnregisterReverbVoice(UAudioComponent* Voice);
+
+	/** The preset last sent to the voices */
+	UFUNCTION(BlueprintPure, Category=Reverb)
+	const FReverbZonePreset& GetListenerPreset() const { return CurrentPreset; }
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Cell edge in cm - about a room */
+	static constexpr float CellSize = 1000.0f;
+
+	/** Volumes covering more cells than this skip the grid */
+	static constexpr int32 MaxCellsPerVolume = 4096;
+
+	FIntVector GetCell(const FVector& Location) const;
+
+	void RebuildGrid();
+
+	/** Blends the presets of the volumes around Location over the default preset */
+	FReverbZonePreset ComputePresetAt(const FVector& Location) const;
+
+	void PushPreset();
+
+	UPROPERTY()
+	TArray<TObjectPtr<AReverbZoneVolume>> Volumes;
+
+	/** Cell to the indices of the volumes reaching into it */
+	TMap<FIntVector, TArray<int32>> Grid;
+	TArray<int32> LargeVolumes;
+	bool bGridDirty = false;
+
+	TArray<TWeakObjectPtr<UAudioComponent>> Voices;
+
+	FReverbZonePreset CurrentPreset;
+	FReverbZonePreset PushedPreset;
+	bool bHasPushed = false;
+
+	/** The batch copied to each voice; the names are built once and only the values are updated */
+	TArray<FAudioParameter> ParameterBatch;
+};
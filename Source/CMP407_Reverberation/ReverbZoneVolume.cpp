@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ReverbZoneVolume.h"
+#include "ReverbZoneSubsystem.h"
+#include "Components/BrushComponent.h"
+#include "Engine/World.h"
+
+void FReverbZonePreset::Lerp(const FReverbZonePreset& A, const FReverbZonePreset& B, float Alpha)
+{
+	PreDelayTime = FMath::Lerp(A.PreDelayTime, B.PreDelayTime, Alpha);
+	DecayRate = FMath::Lerp(A.DecayRate, B.DecayRate, Alpha);
+	DelayDamping = FMath::Lerp(A.DelayDamping, B.DelayDamping, Alpha);
+	LowPassCutOff = FMath::Lerp(A.LowPassCutOff, B.LowPassCutOff, Alpha);
+	InputDiffusion1 = FMath::Lerp(A.InputDiffusion1, B.InputDiffusion1, Alpha);
+	InputDiffusion2 = FMath::Lerp(A.InputDiffusion2, B.InputDiffusion2, Alpha);
+	FinalDelayLeft = FMath::Lerp(A.FinalDelayLeft, B.FinalDelayLeft, Alpha);
+	FinalDelayRight = FMath::Lerp(A.FinalDelayRight, B.FinalDelayRight, Alpha);
+	DecayTimeLow = FMath::Lerp(A.DecayTimeLow, B.DecayTimeLow, Alpha);
+	DecayTimeMid = FMath::Lerp(A.DecayTimeMid, B.DecayTimeMid, Alpha);
+	DecayTimeHigh = FMath::Lerp(A.DecayTimeHigh, B.DecayTimeHigh, Alpha);
+	WetValue = FMath::Lerp(A.WetValue, B.WetValue, Alpha);
+}
+
+void FReverbZonePreset::AddWeighted(const FReverbZonePreset& Other, float Weight)
+{
+	PreDelayTime += Other.PreDelayTime * Weight;
+	DecayRate += Other.DecayRate * Weight;
+	DelayDamping += Other.DelayDamping * Weight;
+	LowPassCutOff += Other.LowPassCutOff * Weight;
+	InputDiffusion1 += Other.InputDiffusion1 * Weight;
+	InputDiffusion2 += Other.InputDiffusion2 * Weight;
+	FinalDelayLeft += Other.FinalDelayLeft * Weight;
+	FinalDelayRight += Other.FinalDelayRight * Weight;
+	DecayTimeLow += Other.DecayTimeLow * Weight;
+	DecayTimeMid += Other.DecayTimeMid * Weight;
+	DecayTimeHigh += Other.DecayTimeHigh * Weight;
+	WetValue += Other.WetValue * Weight;
+}
+
+namespace ReverbZones
+{
+	bool IsNearlyEqualRelative(float A, float B, float Tolerance)
+	{
+		// Relative, so a field in Hz and one in 0 - 1 settle at the same point; the floor keeps fields near zero from never settling
+		return FMath::Abs(A - B) <= Tolerance * FMath::Max3(FMath::Abs(A), FMath::Abs(B), 1.0e-2f);
+	}
+}
+
+bool FReverbZonePreset::Equals(const FReverbZonePreset& Other, float Tolerance) const
+{
+	return ReverbZones::IsNearlyEqualRelative(PreDelayTime, Other.PreDelayTime, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(DecayRate, Other.DecayRate, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(DelayDamping, Other.DelayDamping, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(LowPassCutOff, Other.LowPassCutOff, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(InputDiffusion1, Other.InputDiffusion1, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(InputDiffusion2, Other.InputDiffusion2, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(FinalDelayLeft, Other.FinalDelayLeft, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(FinalDelayRight, Other.FinalDelayRight, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(DecayTimeLow, Other.DecayTimeLow, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(DecayTimeMid, Other.DecayTimeMid, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(DecayTimeHigh, Other.DecayTimeHigh, Tolerance)
+		&& ReverbZones::IsNearlyEqualRelative(WetValue, Other.WetValue, Tolerance);
+}
+
+float AReverbZoneVolume::GetWeightAt(const FVector& Location) const
+{
+	const FBox Bounds = GetBrushComponent()->Bounds.GetBox();
+	const float Distance = FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(Location));
+
+	if (BlendDistance <= 0.0f)
+	{
+		return Distance <= 0.0f ? 1.0f : 0.0f;
+	}
+	return FMath::Clamp(1.0f - Distance / BlendDistance, 0.0f, 1.0f);
+}
+
+void AReverbZoneVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UReverbZoneSubsystem* ReverbZones = GetWorld()->GetSubsystem<UReverbZoneSubsystem>())
+	{
+		ReverbZones->RegisterVolume(this);
+	}
+}
+
+void AReverbZoneVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UReverbZoneSubsystem* ReverbZones = GetWorld()->GetSubsystem<UReverbZoneSubsystem>())
+	{
+		ReverbZones->UnregisterVolume(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+#include "ReverbZoneVolume.generated.h"
+
+/**
+ * The Dattorro reverb node's room parameters, as sent to the MetaSound inputs of the same names. Defaults match the node's.
+ * Only pins the node follows while playing are here - the decay diffusions and feedback delays are set when the graph is built.
+ */
+USTRUCT(BlueprintType)
+struct FReverbZonePreset
+{
+	GENERATED_BODY()
+
+	/** PreDelayTime, in ms - no longer than the graph's own PreDelayTime, which sizes the pre-delay when it is built */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1000.0"))
+	float PreDelayTime = 50.0f;
+
+	/** Decay Rate */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DecayRate = 0.1f;
+
+	/** Delay Damping */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float DelayDamping = 0.005f;
+
+	/** Low Pass CutOff, in Hz */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "20.0", ClampMax = "20000.0"))
+	float LowPassCutOff = 500.0f;
+
+	/** Input Diffusion 1 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float InputDiffusion1 = 0.75f;
+
+	/** Input Diffusion 2 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float InputDiffusion2 = 0.625f;
+
+	/** Final Delay Left, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FinalDelayLeft = 120.0f;
+
+	/** Final Delay Right, in ms */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "2000.0"))
+	float FinalDelayRight = 100.0f;
+
+	/** Decay Time Low, in s - only heard when the graph's reverb is in Three Band decay mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeLow = 3.0f;
+
+	/** Decay Time Mid, in s - only heard when the graph's reverb is in Three Band decay mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeMid = 2.0f;
+
+	/** Decay Time High, in s - only heard when the graph's reverb is in Three Band decay mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.05", ClampMax = "60.0"))
+	float DecayTimeHigh = 0.8f;
+
+	/** Wet Value */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Reverb, meta=(ClampMin = "0.0", ClampMax = "1.0"))
+	float WetValue = 0.65f;
+
+	/** Sets this to A + (B - A) * Alpha, field by field */
+	void Lerp(const FReverbZonePreset& A, const FReverbZonePreset& B, float Alpha);
+
+	/** Adds Other * Weight, field by field */
+	void AddWeighted(const FReverbZonePreset& Other, float Weight);
+
+	/** True if no field differs from Other by more than Tolerance times the larger of the two values */
+	bool Equals(const FReverbZonePreset& Other, float Tolerance) const;
+};
+
+/**
+ * A box of space with its own reverb, e.g. the ship interior or the planet surface.
+ * The reverb zone subsystem blends the presets of the volumes around the listener and sends the result to the reverb voices.
+ */
+UCLASS()
+class CMP407_REVERBERATION_API AReverbZoneVolume : public AVolume
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Reverb)
+	FReverbZonePreset Preset;
+
+	/** Distance (cm) outside the volume's bounds over which its preset fades out */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Reverb, meta=(ClampMin = "0.0"))
+	float BlendDistance = 200.0f;
+
+	/** Where volumes overlap, higher priorities win - a ship zone inside a planet zone should have the higher priority */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Reverb)
+	int32 Priority = 0;
+
+	/** Weight (0 to 1) of this volume's preset at Location - 1 inside its bounds, falling to 0 at BlendDistance outside */
+	float GetWeightAt(const FVector& Location) const;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
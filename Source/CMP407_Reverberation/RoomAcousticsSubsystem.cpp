@@ -0,0 +1,308 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RoomAcousticsSubsystem.h"
+#include "ReverbZoneSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+namespace RoomAcoustics
+{
+	constexpr float SpeedOfSound = 343.0f;
+	constexpr float MinRT60 = 0.05f;
+	constexpr float MaxRT60 = 60.0f;
+	// The reverb node sizes its pre-delay from the graph's PreDelayTime when it is built (50 ms by default) and clamps
+	// longer reads, so a longer estimate would never be heard
+	constexpr float MaxPreDelay = 50.0f;
+	constexpr int32 MinRays = 8;
+	constexpr int32 MaxRays = 1024;
+
+	// Sample rate the Decay Rate mapping assumes
+	constexpr float AssumedSampleRate = 48000.0f;
+
+	// The tank's two decay diffusion delays, in samples, as the node sets them
+	constexpr float DecayDiffusionSamples = 250.0f + 770.0f;
+
+	// The node's default left Feedback Delay, in ms - zones cannot change it, as it is set when the graph is built
+	constexpr float FeedbackDelayLeft = 80.0f;
+}
+
+void URoomAcousticsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RayDelegate.BindUObject(this, &URoomAcousticsSubsystem::OnRayDone);
+}
+
+bool URoomAcousticsSubsystem::GetListenerEstimate(FRoomAcousticsEstimate& OutEstimate) const
+{
+	const FRoomAcousticsEstimate* Estimate = bHasListenerCell ? Cache.Find(ListenerCell) : nullptr;
+	if (Estimate == nullptr)
+	{
+		return false;
+	}
+
+	OutEstimate = *Estimate;
+	return true;
+}
+
+void URoomAcousticsSubsystem::ClearCache()
+{
+	Cache.Reset();
+	bHasApplied = false;
+}
+
+void URoomAcousticsSubsystem::MakeRayDirections(int32 NumRays, TArray<FVector>& OutDirections)
+{
+	const float GoldenAngle = PI * (3.0f - FMath::Sqrt(5.0f));
+	OutDirections.SetNumUninitialized(NumRays);
+	for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+	{
+		const float Z = 1.0f - 2.0f * (RayIndex + 0.5f) / NumRays;
+		const float Radius = FMath::Sqrt(1.0f - Z * Z);
+		const float Phi = GoldenAngle * RayIndex;
+		OutDirections[RayIndex] = FVector(FMath::Cos(Phi) * Radius, FMath::Sin(Phi) * Radius, Z);
+	}
+}
+
+FRoomAcousticsEstimate URoomAcousticsSubsystem::EstimateRoom(TConstArrayView<float> RayDistances, TConstArrayView<bool> RayHits, float SurfaceAbsorption)
+{
+	using namespace RoomAcoustics;
+
+	check(RayDistances.Num() == RayHits.Num() && RayDistances.Num() > 0);
+	const float SolidAngle = 4.0f * PI / RayDistances.Num();
+
+	// In metres
+	float Volume = 0.0f;
+	float Surface = 0.0f;
+	float OpenSurface = 0.0f;
+	for (int32 RayIndex = 0; RayIndex < RayDistances.Num(); RayIndex++)
+	{
+		const float Distance = 0.01f * RayDistances[RayIndex];
+		const float Area = SolidAngle * Distance * Distance;
+		Volume += Area * Distance / 3.0f;
+		Surface += Area;
+		if (!RayHits[RayIndex])
+		{
+			OpenSurface += Area;
+		}
+	}
+
+	const float Absorption = (Surface - OpenSurface) * SurfaceAbsorption + OpenSurface;
+
+	FRoomAcousticsEstimate Estimate;
+	Estimate.Volume = Volume;
+	Estimate.SurfaceArea = Surface;
+	Estimate.OpenFraction = Surface > 0.0f ? OpenSurface / Surface : 1.0f;
+	Estimate.RT60 = FMath::Clamp(0.161f * Volume / FMath::Max(Absorption, KINDA_SMALL_NUMBER), MinRT60, MaxRT60);
+	Estimate.PreDelay = Surface > 0.0f ? FMath::Clamp(1000.0f * (4.0f * Volume / Surface) / SpeedOfSound, 0.0f, MaxPreDelay) : 0.0f;
+	return Estimate;
+}
+
+void URoomAcousticsSubsystem::ApplyEstimate(const FRoomAcousticsEstimate& Estimate, float LowDecayRatio, float HighDecayRatio, FReverbZonePreset& InOutPreset)
+{
+	using namespace RoomAcoustics;
+
+	InOutPreset.DecayTimeMid = Estimate.RT60;
+	InOutPreset.DecayTimeLow = FMath::Clamp(Estimate.RT60 * LowDecayRatio, MinRT60, MaxRT60);
+	InOutPreset.DecayTimeHigh = FMath::Clamp(Estimate.RT60 * HighDecayRatio, MinRT60, MaxRT60);
+	InOutPreset.PreDelayTime = Estimate.PreDelay;
+
+	// Decay Rate is a gain per trip round the tank - the node's own three band gains use 10^(-3 N / (RT60 * SampleRate))
+	// for a pass of N samples. The feedback and final delays are in ms.
+	const float PassSamples = DecayDiffusionSamples + (FeedbackDelayLeft + InOutPreset.FinalDelayLeft) * AssumedSampleRate * 0.001f;
+	InOutPreset.DecayRate = FMath::Pow(10.0f, -3.0f * PassSamples / (Estimate.RT60 * AssumedSampleRate));
+}
+
+void URoomAcousticsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ProbeGrid.Load(AcousticProbes::GetGridFilename(UWorld::RemovePIEPrefix(InWorld.GetMapName())));
+}
+
+bool URoomAcousticsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URoomAcousticsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController == nullptr)
+	{
+		return;
+	}
+
+	FVector ListenerLocation;
+	FVector FrontDir;
+	FVector RightDir;
+	PlayerController->GetAudioListenerPosition(ListenerLocation, FrontDir, RightDir);
+
+	// Baked probes replace the traces
+	if (ProbeGrid.IsLoaded())
+	{
+		if (bDriveReverb)
+		{
+			FReverbZonePreset Preset;
+			UReverbZoneSubsystem* ReverbZones = GetReverbZones(Preset);
+			if (ReverbZones != nullptr && ProbeGrid.Sample(ListenerLocation, Preset))
+			{
+				ReverbZones->DefaultPreset = Preset;
+				bHasApplied = true;
+			}
+		}
+		else if (bHasApplied)
+		{
+			DriveReverbZones(nullptr);
+		}
+		return;
+	}
+
+	ListenerCell = GetCacheCell(ListenerLocation);
+	bHasListenerCell = true;
+
+	// A measurement only counts for the cell it was started in
+	if (bMeasuring && MeasureCell != ListenerCell)
+	{
+		bMeasuring = false;
+	}
+
+	const FRoomAcousticsEstimate* Estimate = Cache.Find(ListenerCell);
+	if (Estimate == nullptr && !bMeasuring)
+	{
+		StartMeasurement(ListenerCell, ListenerLocation);
+	}
+
+	if (bMeasuring)
+	{
+		IssueRays(PlayerController->GetPawn());
+	}
+
+	// Cells not measured yet keep the last room heard
+	if (bDriveReverb)
+	{
+		if (Estimate != nullptr && (!bHasApplied || AppliedCell != ListenerCell))
+		{
+			DriveReverbZones(Estimate);
+			AppliedCell = ListenerCell;
+		}
+	}
+	else if (bHasApplied)
+	{
+		DriveReverbZones(nullptr);
+	}
+}
+
+TStatId URoomAcousticsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URoomAcousticsSubsystem, STATGROUP_Tickables);
+}
+
+FIntVector URoomAcousticsSubsystem::GetCacheCell(const FVector& Location) const
+{
+	const float CellSize = FMath::Max(CacheCellSize, 1.0f);
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void URoomAcousticsSubsystem::StartMeasurement(const FIntVector& Cell, const FVector& Origin)
+{
+	const int32 NumDirections = FMath::Clamp(NumRays, RoomAcoustics::MinRays, RoomAcoustics::MaxRays);
+	if (RayDirections.Num() != NumDirections)
+	{
+		MakeRayDirections(NumDirections, RayDirections);
+	}
+
+	RayDistances.SetNumUninitialized(NumDirections);
+	RayHits.Init(false, NumDirections);
+	NextRay = 0;
+	RaysDone = 0;
+
+	MeasureCell = Cell;
+	MeasureOrigin = Origin;
+	MeasurementSerial++;
+	bMeasuring = true;
+}
+
+void URoomAcousticsSubsystem::IssueRays(const AActor* IgnoredActor)
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(RoomAcoustics), false, IgnoredActor);
+
+	// The ray index and the measurement it belongs to ride along in the trace's user data
+	const uint32 SerialBits = (MeasurementSerial & 0xFFFF) << 16;
+
+	for (int32 Issued = 0; Issued < FMath::Max(RaysPerFrame, 1) && NextRay < RayDirections.Num(); Issued++, NextRay++)
+	{
+		const FVector End = MeasureOrigin + RayDirections[NextRay] * RayLength;
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, MeasureOrigin, End, ECC_Visibility, Params,
+			FCollisionResponseParams::DefaultResponseParam, &RayDelegate, SerialBits | static_cast<uint32>(NextRay));
+	}
+}
+
+void URoomAcousticsSubsystem::OnRayDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (!bMeasuring || (Datum.UserData >> 16) != (MeasurementSerial & 0xFFFF))
+	{
+		return;
+	}
+
+	const int32 RayIndex = Datum.UserData & 0xFFFF;
+	const bool bHit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+	RayHits[RayIndex] = bHit;
+	RayDistances[RayIndex] = bHit ? Datum.OutHits[0].Distance : RayLength;
+
+	if (++RaysDone == RayDirections.Num())
+	{
+		FinishMeasurement();
+	}
+}
+
+void URoomAcousticsSubsystem::FinishMeasurement()
+{
+	if (Cache.Num() >= MaxCachedCells)
+	{
+		Cache.Reset();
+	}
+	Cache.Add(MeasureCell, EstimateRoom(RayDistances, RayHits, SurfaceAbsorption));
+
+	bMeasuring = false;
+}
+
+UReverbZoneSubsystem* URoomAcousticsSubsystem::GetReverbZones(FReverbZonePreset& OutBasePreset)
+{
+	UReverbZoneSubsystem* ReverbZones = GetWorld()->GetSubsystem<UReverbZoneSubsystem>();
+	if (ReverbZones == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (!BasePreset.IsSet())
+	{
+		BasePreset = ReverbZones->DefaultPreset;
+	}
+	OutBasePreset = BasePreset.GetValue();
+	return ReverbZones;
+}
+
+void URoomAcousticsSubsystem::DriveReverbZones(const FRoomAcousticsEstimate* Estimate)
+{
+	FReverbZonePreset Preset;
+	UReverbZoneSubsystem* ReverbZones = GetReverbZones(Preset);
+	if (ReverbZones == nullptr)
+	{
+		return;
+	}
+
+	if (Estimate != nullptr)
+	{
+		ApplyEstimate(*Estimate, LowDecayRatio, HighDecayRatio, Preset);
+	}
+	ReverbZones->DefaultPreset = Preset;
+
+	bHasApplied = Estimate != nullptr;
+}
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "ReverbZoneVolume.h"
+#include "AcousticProbeGrid.h"
+#include "RoomAcousticsSubsystem.generated.h"
+
+/** The room around a point, as measured by a fan of traces */
+USTRUCT(BlueprintType)
+struct FRoomAcousticsEstimate
+{
+	GENERATED_BODY()
+
+	/** Volume in cubic metres */
+	UPROPERTY(BlueprintReadOnly, Category=Reverb)
+	float Volume = 0.0f;
+
+	/** Surface area in square metres, open directions included */
+	UPROPERTY(BlueprintReadOnly, Category=Reverb)
+	float SurfaceArea = 0.0f;
+
+	/** Share (0 to 1) of the surface that is open - rays that hit nothing */
+	UPROPERTY(BlueprintReadOnly, Category=Reverb)
+	float OpenFraction = 0.0f;
+
+	/** Sabine reverberation time in seconds */
+	UPROPERTY(BlueprintReadOnly, Category=Reverb)
+	float RT60 = 0.0f;
+
+	/** Mean free path travel time in ms */
+	UPROPERTY(BlueprintReadOnly, Category=Reverb)
+	float PreDelay = 0.0f;
+};
+
+/**
+ * Measures the room around the listener and makes it the reverb zone subsystem's default preset, so places no reverb zone
+ * covers still follow their geometry.
+ * A measurement is a Fibonacci sphere of async line traces from the listener, issued at most RaysPerFrame a frame and read
+ * back as they complete. Each ray stands for an equal solid angle: its cone gives the volume (d^3 / 3 per steradian) and its
+ * end cap the surface (d^2 per steradian). Walls absorb SurfaceAbsorption of what reaches them and open directions absorb
+ * everything, which gives Sabine's RT60 = 0.161 V / A; the pre-delay is the mean free path 4 V / S over the speed of sound.
+ * Estimates are cached per CacheCellSize cell, so coming back to a spot costs no traces.
+ * Maps with a baked probe grid (see UBakeAcousticProbesCommandlet) read it instead and issue no traces at all.
+ */
+UCLASS()
+class CMP407_REVERBERATION_API URoomAcousticsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Whether the estimates drive the reverb zone subsystem's default preset */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	bool bDriveReverb = true;
+
+	/** Rays per measurement */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	int32 NumRays = 64;
+
+	/** Most rays issued in one frame */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	int32 RaysPerFrame = 8;
+
+	/** Ray length in cm - a ray that reaches it counts as open */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float RayLength = 5000.0f;
+
+	/** Share (0 to 1) of the sound reaching a wall that the wall absorbs */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float SurfaceAbsorption = 0.1f;
+
+	/** Decay Time Low and High as multiples of the estimated RT60, which sets Decay Time Mid */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float LowDecayRatio = 1.3f;
+
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float HighDecayRatio = 0.5f;
+
+	/** Edge (cm) of the cells estimates are cached by */
+	UPROPERTY(BlueprintReadWrite, Category=Reverb)
+	float CacheCellSize = 500.0f;
+
+	/** The estimate for the listener's cell, if there is one yet */
+	UFUNCTION(BlueprintPure, Category=Reverb)
+	bool GetListenerEstimate(FRoomAcousticsEstimate& OutEstimate) const;
+
+	/** Forgets every cached estimate, e.g. after the level geometry has changed */
+	UFUNCTION(BlueprintCallable, Category=Reverb)
+	void ClearCache();
+
+	/** Fibonacci sphere of NumRays directions - even coverage, so every ray stands for the same solid angle */
+	static void MakeRayDirections(int32 NumRays, TArray<FVector>& OutDirections);
+
+	/** Folds one measurement's ray lengths (cm) and hits into a room estimate */
+	static FRoomAcousticsEstimate EstimateRoom(TConstArrayView<float> RayDistances, TConstArrayView<bool> RayHits, float SurfaceAbsorption);
+
+	/** Writes an estimate into the reverb parameters it drives: decay times, Decay Rate and pre-delay */
+	static void ApplyEstimate(const FRoomAcousticsEstimate& Estimate, float LowDecayRatio, float HighDecayRatio, FReverbZonePreset& InOutPreset);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Cached cells kept before the cache is cleared */
+	static constexpr int32 MaxCachedCells = 4096;
+
+	FIntVector GetCacheCell(const FVector& Location) const;
+
+	void StartMeasurement(const FIntVector& Cell, const FVector& Origin);
+
+	/** Issues the next RaysPerFrame rays of the measurement */
+	void IssueRays(const AActor* IgnoredActor);
+
+	void OnRayDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	void FinishMeasurement();
+
+	/** The reverb zone subsystem, and its default preset from before any estimate */
+	class UReverbZoneSubsystem* GetReverbZones(FReverbZonePreset& OutBasePreset);
+
+	/** Makes the estimate (or nothing, restoring the base) the reverb zone subsystem's default preset */
+	void DriveReverbZones(const FRoomAcousticsEstimate* Estimate);
+
+	TMap<FIntVector, FRoomAcousticsEstimate> Cache;
+
+	FIntVector ListenerCell = FIntVector::ZeroValue;
+	bool bHasListenerCell = false;
+
+	/** The measurement under way */
+	bool bMeasuring = false;
+	FIntVector MeasureCell = FIntVector::ZeroValue;
+	FVector MeasureOrigin = FVector::ZeroVector;
+	TArray<FVector> RayDirections;
+	TArray<float> RayDistances;
+	TArray<bool> RayHits;
+	int32 NextRay = 0;
+	int32 RaysDone = 0;
+
+	/** Tells rays of an abandoned measurement from the current one's */
+	uint32 MeasurementSerial = 0;
+
+	FTraceDelegate RayDelegate;
+
+	/** Baked probes for the map, if it has them */
+	FAcousticProbeGrid ProbeGrid;
+
+	/** The reverb zone default preset before any estimate was applied */
+	TOptional<FReverbZonePreset> BasePreset;
+	FIntVector AppliedCell = FIntVector::ZeroValue;
+	bool bHasApplied = false;
+};